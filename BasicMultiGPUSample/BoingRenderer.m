@@ -50,7 +50,10 @@
 #import "shaderUtil.h"
 #import "fileUtil.h"
 #import "debug.h"
+#import "trigUtil.h"
 #import <GLKit/GLKit.h>
+#import <OpenGL/OpenGL.h>
+#import <pthread.h>
 
 // Shaders
 enum {
@@ -129,13 +132,13 @@ static float shininess      = 10.0;
     
     GLKVector3 lightDirNormalized;
     GLKMatrix4 projectionMatrix;
+    CGLShareGroupObj shareGroup;
     GLuint vboId, vaoId;
 }
 @end
 
-@implementation BoingRenderer
-
--(void)generateBoingData
+// Tessellate a ball of radius r into 8 * 16 quads of two triangles each
+static void generateBoingVertices(Vertex *boingData, float r)
 {
 	int x;
 	int index = 0;
@@ -146,43 +149,52 @@ static float shininess      = 10.0;
 	
 	int theta, phi;
 	
-	float theta0, theta1;
-	float phi0, phi1;
+	int theta0, theta1;
+	int phi0, phi1;
 	
 	Vertex quad[4];
 	
-	Vertex *boingData = malloc(8 * 16 * 6 * sizeof(Vertex));
-	
 	float delta = M_PI / 8.0f;
 	
+	// Both angles step by delta, so every sin/cos the tessellation needs is in
+	// one 17 entry table computed in a single batched call
+	float angles[17], sinTab[17], cosTab[17];
+	
+	for(x = 0; x < 17; x++)
+	{
+		angles[x] = x*delta;
+	}
+	
+	trigSinCosN(sinTab, cosTab, angles, 17);
+	
 	// 8 vertical segments
 	for(theta = 0; theta < 8; theta++)
 	{
-		theta0 = theta*delta;
-		theta1 = (theta+1)*delta;
+		theta0 = theta;
+		theta1 = theta+1;
 		
 		// 16 horizontal segments
 		for(phi = 0; phi < 16; phi++)
 		{
-			phi0 = phi*delta;
-			phi1 = (phi+1)*delta;
+			phi0 = phi;
+			phi1 = phi+1;
 			
 			// Generate 4 points per quad
-			quad[0].x = r * sin(theta0)*cos(phi0);
-			quad[0].y = r * cos(theta0);
-			quad[0].z = r * sin(theta0)*sin(phi0);
+			quad[0].x = r * sinTab[theta0]*cosTab[phi0];
+			quad[0].y = r * cosTab[theta0];
+			quad[0].z = r * sinTab[theta0]*sinTab[phi0];
 			
-			quad[1].x = r * sin(theta0)*cos(phi1);
-			quad[1].y = r * cos(theta0);
-			quad[1].z = r * sin(theta0)*sin(phi1);
+			quad[1].x = r * sinTab[theta0]*cosTab[phi1];
+			quad[1].y = r * cosTab[theta0];
+			quad[1].z = r * sinTab[theta0]*sinTab[phi1];
 			
-			quad[2].x = r * sin(theta1)*cos(phi1);
-			quad[2].y = r * cos(theta1);
-			quad[2].z = r * sin(theta1)*sin(phi1);
+			quad[2].x = r * sinTab[theta1]*cosTab[phi1];
+			quad[2].y = r * cosTab[theta1];
+			quad[2].z = r * sinTab[theta1]*sinTab[phi1];
 			
-			quad[3].x = r * sin(theta1)*cos(phi0);
-			quad[3].y = r * cos(theta1);
-			quad[3].z = r * sin(theta1)*sin(phi0);
+			quad[3].x = r * sinTab[theta1]*cosTab[phi0];
+			quad[3].y = r * cosTab[theta1];
+			quad[3].z = r * sinTab[theta1]*sinTab[phi0];
 			
 			// Generate normal
 			if(theta >= 4)
@@ -258,15 +270,112 @@ static float shininess      = 10.0;
             boingData[index++] = quad[0];
 		}
 	}
+}
+
+// Ball meshes, shared by every renderer of the same radius drawing from
+// the same share group, so each ball is tessellated and uploaded once.
+// Renderers are created and released on the display link thread of their
+// view, so the table is only touched under its mutex.
+typedef struct
+{
+	CGLShareGroupObj shareGroup;
+	float r;
+	GLuint vboId;
+	int refCount;
+} BoingMesh;
+
+#define MAX_BOING_MESHES 8
+
+static BoingMesh boingMeshes[MAX_BOING_MESHES];
+static int boingMeshCount = 0;
+static pthread_mutex_t boingMeshLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Return the buffer of a ball mesh for the current context, whose share
+// group is shareGroup, creating it for its first renderer
+static GLuint acquireBoingMesh(CGLShareGroupObj shareGroup, float r)
+{
+	int i;
+	
+	pthread_mutex_lock(&boingMeshLock);
+	
+	for(i = 0; i < boingMeshCount; i++)
+	{
+		if(boingMeshes[i].shareGroup == shareGroup && boingMeshes[i].r == r)
+		{
+			GLuint vboId = boingMeshes[i].vboId;
+			
+			boingMeshes[i].refCount++;
+			pthread_mutex_unlock(&boingMeshLock);
+			return vboId;
+		}
+	}
+	
+	Vertex *boingData = malloc(8 * 16 * 6 * sizeof(Vertex));
+	GLuint vboId = 0;
+	
+	generateBoingVertices(boingData, r);
+	
+	// Create a VBO (vertex buffer object) to hold our data.
+	glGenBuffers(1, &vboId);
+	glBindBuffer(GL_ARRAY_BUFFER, vboId);
+	glBufferData(GL_ARRAY_BUFFER, 8 * 16 * 6 * sizeof(Vertex), boingData, GL_STATIC_DRAW);
+	
+	free(boingData);
+	
+	// A full registry only means the mesh is not shared
+	if(boingMeshCount < MAX_BOING_MESHES)
+	{
+		boingMeshes[boingMeshCount].shareGroup = shareGroup;
+		boingMeshes[boingMeshCount].r = r;
+		boingMeshes[boingMeshCount].vboId = vboId;
+		boingMeshes[boingMeshCount].refCount = 1;
+		boingMeshCount++;
+	}
+	
+	pthread_mutex_unlock(&boingMeshLock);
+	
+	return vboId;
+}
+
+// Release a renderer's ball mesh, deleting the buffer with its last renderer.
+// Buffer names are only unique within a share group, so both are matched.
+static void releaseBoingMesh(CGLShareGroupObj shareGroup, GLuint vboId)
+{
+	int i;
+	
+	pthread_mutex_lock(&boingMeshLock);
+	
+	for(i = 0; i < boingMeshCount; i++)
+	{
+		if(boingMeshes[i].shareGroup == shareGroup && boingMeshes[i].vboId == vboId)
+		{
+			if(--boingMeshes[i].refCount == 0)
+			{
+				glDeleteBuffers(1, &vboId);
+				boingMeshes[i] = boingMeshes[--boingMeshCount];
+			}
+			pthread_mutex_unlock(&boingMeshLock);
+			return;
+		}
+	}
 	
+	pthread_mutex_unlock(&boingMeshLock);
+	
+	glDeleteBuffers(1, &vboId);
+}
+
+@implementation BoingRenderer
+
+-(void)generateBoingData
+{
 	// Create a VAO (vertex array object).
 	glGenVertexArrays(1, &vaoId);
 	glBindVertexArray(vaoId);
 	
-	// Create a VBO (vertex buffer object) to hold our data.
-    glGenBuffers(1, &vboId);
+	// Source it from the shared VBO (vertex buffer object) of the ball.
+	shareGroup = CGLGetShareGroup(CGLGetCurrentContext());
+	vboId = acquireBoingMesh(shareGroup, r);
 	glBindBuffer(GL_ARRAY_BUFFER, vboId);
-	glBufferData(GL_ARRAY_BUFFER, 8 * 16 * 6 * sizeof(Vertex), boingData, GL_STATIC_DRAW);
 	
     // positions
     glEnableVertexAttribArray(ATTRIB_VERTEX);
@@ -283,8 +392,6 @@ static float shininess      = 10.0;
     // At this point the VAO is set up with three vertex attributes referencing the same buffer object.
     
     glError();
-	
-	free(boingData);
 }
 
 - (void)setupShaders
@@ -470,7 +577,7 @@ static float shininess      = 10.0;
 - (void)dealloc
 {
     if (vboId) {
-        glDeleteBuffers(1, &vboId);
+        releaseBoingMesh(shareGroup, vboId);
         vboId = 0;
     }
     if (vaoId) {
@@ -70,8 +70,8 @@ enum GLTextType
 enum GLKeyDown
 {
 	GLKeyDownFullscreen         = 27,	// ASCII ESC - Fullscreen
-	GLKeyDownTextNonPerspective = 110,	// ASCII 'n' - Non-perspective text
-	GLKeyDownTextPerspective    = 112	// ASCII 'p' - Perspective text
+	GLKeyDownTextNonPerspective = 110,	// ASCII 'n' - Show or hide the non-perspective text
+	GLKeyDownTextPerspective    = 112	// ASCII 'p' - Show or hide the perspective text
 };
 
 #pragma mark -
@@ -86,6 +86,8 @@ enum GLKeyDown
 - (void) initOpenGL;
 - (void) queryOpenGL;
 
+- (void) toggleText:(GLuint)nText;
+
 @end
 
 #pragma mark -
@@ -93,20 +95,39 @@ enum GLKeyDown
 @implementation AppView
 {
 @private
-    BOOL          mbFullscreen;
-    GLU::TextRef  mpText[2];
-    NSPoint       m_MousePt;
-    GLuint        mnSelector;
+    BOOL               mbFullscreen;
+    BOOL               mbVisible[2];
+    GLU::TextRef       mpText[2];
+    GLU::TextBatchRef  mpBatch;
+    NSPoint            m_MousePt;
 } // AppView
 
 // Draw texts in a scene
 - (void) scene
 {
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    
     // No need to flush the buffer here.  The base class render method
     // takes care of this.
-    GLU::TextDisplay(mpText[mnSelector]);
+    GLU::TextBatchDisplay(mpBatch);
 } // scene
 
+// Show or hide a text
+- (void) toggleText:(GLuint)nText
+{
+    if(mbVisible[nText])
+    {
+        GLU::TextBatchRemove(mpText[nText], mpBatch);
+        
+        mbVisible[nText] = NO;
+    } // if
+    else
+    {
+        // Stays hidden if the batch could not take it
+        mbVisible[nText] = GLU::TextBatchAdd(mpText[nText], mpBatch);
+    } // else
+} // toggleText
+
 // When application is terminating cleanup the objects
 - (void) terminate:(NSNotification *)notification
 {
@@ -138,9 +159,16 @@ enum GLKeyDown
 // Tear-down objects
 - (void) cleanup
 {
+	GLU::TextBatchDelete(mpBatch);
+	
+	mpBatch = NULL;
+	
 	GLU::TextDelete(mpText[kGLUTextPrespective]);
 	GLU::TextDelete(mpText[kGLUTextNonPrespective]);
 	
+	// The cache keeps the vertices of deleted texts
+	GLU::TextCachePurge();
+	
     [super cleanup];
 } // cleanup
 
@@ -205,6 +233,12 @@ enum GLKeyDown
 															   position,
 															   gradientColors2);
 	
+	// Both texts are drawn by a single batch
+	mpBatch = GLU::TextBatchCreate();
+	
+	mbVisible[kGLUTextPrespective]    = GLU::TextBatchAdd(mpText[kGLUTextPrespective], mpBatch);
+	mbVisible[kGLUTextNonPrespective] = GLU::TextBatchAdd(mpText[kGLUTextNonPrespective], mpBatch);
+	
     // Set the swap interval
 	GLint nSyncVR = GL_TRUE;
     
@@ -276,12 +310,14 @@ enum GLKeyDown
 				break;
 				
 			case GLKeyDownTextNonPerspective:
-				mnSelector = kGLUTextNonPrespective;
+				[self toggleText:kGLUTextNonPrespective];
 				break;
 				
 			case GLKeyDownTextPerspective:
+				[self toggleText:kGLUTextPrespective];
+				break;
+				
 			default:
-				mnSelector = kGLUTextPrespective;
 				break;
 		} // switch
         
@@ -70,6 +70,35 @@ namespace GLU
     // opaque data reference.
     typedef struct Array *ArrayRef;
     
+    // Vertex layouts of interleaved arrays.  Vertices are tightly packed,
+    // so the stride is 32, 40, and 52 bytes respectively.
+    enum ArrayLayout
+    {
+        kArrayLayout2D = 0,     // positions, texture coordinates, colors
+        kArrayLayout3D,         // as above, in 3D
+        kArrayLayout3DNormals   // 3D positions, normals, texture coordinates, colors
+    }; // ArrayLayout
+    
+    // Attributes of an interleaved array
+    enum ArrayAttribute
+    {
+        kArrayPositions = 0,
+        kArrayNormals,
+        kArrayTexCoords,
+        kArrayColors
+    }; // ArrayAttribute
+    
+    // Strided view of one attribute of an interleaved array.  Vertex i
+    // starts mnStride * i bytes past mpData.  Valid until the array is
+    // deleted; mpData is null when the array has no such attribute.
+    struct ArraySpan
+    {
+        const GLfloat *mpData;
+        GLuint   mnCount;           // Vertex count
+        GLuint   mnComponents;      // Floats per vertex
+        GLsizei  mnStride;          // Bytes between vertices
+    }; // ArraySpan
+    
     // Create an interleaved array for 2D objects
     ArrayRef ArrayCreate(const GLuint& rCount,
                          const GLfloat * const pPositions,
@@ -83,6 +112,26 @@ namespace GLU
                          const GLfloat * const pTexCoords,
                          const GLfloat * const pColors);
     
+    // Create an interleaved array for 2D objects in storage owned by the
+    // caller, of at least ArrayGetStorageSize(kArrayLayout2D) bytes aligned to
+    // ArrayGetStorageAlignment.  The storage must outlive the array and is
+    // not released by ArrayDelete.
+    ArrayRef ArrayCreateWithStorage(const GLuint& rCount,
+                                    const GLfloat * const pPositions,
+                                    const GLfloat * const pTexCoords,
+                                    const GLfloat * const pColors,
+                                    GLvoid *pStorage);
+    
+    // Create an interleaved array for 3D objects in storage owned by the
+    // caller, sized for kArrayLayout3DNormals when there are normals or
+    // kArrayLayout3D otherwise
+    ArrayRef ArrayCreateWithStorage(const GLuint& rCount,
+                                    const GLfloat * const pPositions,
+                                    const GLfloat * const pNormals,
+                                    const GLfloat * const pTexCoords,
+                                    const GLfloat * const pColors,
+                                    GLvoid *pStorage);
+    
     // Create an interleaved array for a quad 2D object
     ArrayRef ArrayCreateQuad(const GLfloat * const pPositions,
                              const GLfloat * const pTexCoords,
@@ -94,6 +143,38 @@ namespace GLU
     // The vertex count
     const GLuint ArrayGetCount(const ArrayRef pArray);
     
+    // Bytes between consecutive vertices
+    const GLsizei ArrayGetStride(const ArrayRef pArray);
+    
+    // The vertex layout
+    const ArrayLayout ArrayGetLayout(const ArrayRef pArray);
+    
+    // Bytes of storage for an interleaved array of the given vertex count
+    const GLsizeiptr ArrayGetStorageSize(const ArrayLayout& rLayout,
+                                         const GLuint& rCount);
+    
+    // Alignment, in bytes, of storage for an interleaved array
+    const GLsizeiptr ArrayGetStorageAlignment();
+    
+    // Strided view of an attribute of an interleaved array
+    const ArraySpan ArrayGetSpan(const ArrayAttribute& rAttribute,
+                                 const ArrayRef pArray);
+    
+    // Copy rCount vertices of an attribute, starting at rFirst, into a
+    // packed buffer of rComponents floats per vertex.  Components past the
+    // attribute's own are zero filled.  Returns the vertex count copied.
+    const GLuint ArrayCopyAttribute(const ArrayAttribute& rAttribute,
+                                    const GLuint& rFirst,
+                                    const GLuint& rCount,
+                                    const GLuint& rComponents,
+                                    GLfloat *pDst,
+                                    const ArrayRef pArray);
+    
+    // Axis aligned bounds of the positions, with z = 0 for 2D arrays
+    const bool ArrayGetBounds(vector_float3& rMin,
+                              vector_float3& rMax,
+                              const ArrayRef pArray);
+    
     // Accessors for 2D positions in an interleaved array
     const vector_float2 ArrayGetPosition2D(const GLuint& rIndex, const ArrayRef pArray);
     
@@ -50,6 +50,19 @@
 #pragma mark -
 #pragma mark Headers
 
+// C string and memory functions
+#import <cstring>
+
+// STL algorithms
+#import <algorithm>
+
+// SIMD shuffles for the interleave
+#if defined(__SSE2__)
+#import <emmintrin.h>
+#elif defined(__ARM_NEON)
+#import <arm_neon.h>
+#endif
+
 // OpenGL vertices private type
 #import "GLUVertices.h"
 
@@ -57,94 +70,300 @@
 #import "GLUArray.h"
 
 #pragma mark -
-#pragma mark Private - Utilities - Vertices
-
-// Append a to a vertex, positions, texture coordinates, and colors
-static void GLUVertexPushback(const GLuint& rIndex,
-                              const GLfloat * const pPositions,
-                              const GLfloat * const pTexCoords,
-                              const GLfloat * const pColors,
-                              GLU::ArrayRef pArray)
-{
-    const GLfloat *positions = pPositions + rIndex * 2;
-    const GLfloat *texcoords = pTexCoords + rIndex * 2;
-    const GLfloat *colors    = pColors    + rIndex * 4;
-    
-    vector_float2 vPositions = {positions[0], positions[1]};
-    vector_float2 vTexCoords = {texcoords[0], texcoords[1]};
-    vector_float4 vColors    = {colors[0], colors[1], colors[2], colors[3]};
-    
-    pArray->m_Vertices.push_back(GLU::Vertex(vPositions, vTexCoords, vColors));
-} //GLUVertexPushback
-
-// Append a to a vertex, positions, texture coordinates, and colors
-static void GLUVertexPushback(const GLuint& rIndex,
-                              const GLfloat * const pPositions,
-                              const GLfloat * const pNormals,
-                              const GLfloat * const pTexCoords,
-                              const GLfloat * const pColors,
-                              GLU::ArrayRef pArray)
+#pragma mark Private - Utilities - Interleave
+
+// Interleave pairs of 2D positions and texture coordinates into
+// consecutive vertices, with a stride in floats
+static void GLUArrayInterleave2x2(const GLuint& rCount,
+                                  const GLfloat * const pPositions,
+                                  const GLfloat * const pTexCoords,
+                                  const size_t& rStride,
+                                  GLfloat *pDst)
 {
-    const GLfloat *positions = pPositions + rIndex * 3;
-    const GLfloat *texcoords = pTexCoords + rIndex * 3;
-    const GLfloat *colors    = pColors    + rIndex * 4;
-    
-    vector_float3 vPositions = {positions[0], positions[1], positions[2]};
-    vector_float3 vTexCoords = {texcoords[0], texcoords[1], texcoords[2]};
-    vector_float4 vColors    = {colors[0], colors[1], colors[2], colors[3]};
+    GLuint i = 0;
     
-    if(pNormals != nullptr)
+#if defined(__SSE2__)
+    for(; (i + 2) <= rCount; i += 2, pDst += 2 * rStride)
     {
-        const GLfloat *normals = pNormals + rIndex * 3;
+        __m128 p = _mm_loadu_ps(pPositions + 2 * i);    // px0 py0 px1 py1
+        __m128 t = _mm_loadu_ps(pTexCoords + 2 * i);    // tx0 ty0 tx1 ty1
         
-        vector_float3 vNormals = {normals[0], normals[1], normals[2]};
+        _mm_storeu_ps(pDst,           _mm_movelh_ps(p, t));
+        _mm_storeu_ps(pDst + rStride, _mm_movehl_ps(t, p));
+    } // for
+#elif defined(__ARM_NEON)
+    for(; (i + 2) <= rCount; i += 2, pDst += 2 * rStride)
+    {
+        float32x4_t p = vld1q_f32(pPositions + 2 * i);
+        float32x4_t t = vld1q_f32(pTexCoords + 2 * i);
         
-        pArray->m_Vertices.push_back(GLU::Vertex(vPositions, vNormals, vTexCoords, vColors));
+        vst1q_f32(pDst,           vcombine_f32(vget_low_f32(p),  vget_low_f32(t)));
+        vst1q_f32(pDst + rStride, vcombine_f32(vget_high_f32(p), vget_high_f32(t)));
+    } // for
+#endif
+    
+    for(; i < rCount; ++i, pDst += rStride)
+    {
+        pDst[0] = pPositions[2 * i];
+        pDst[1] = pPositions[2 * i + 1];
+        pDst[2] = pTexCoords[2 * i];
+        pDst[3] = pTexCoords[2 * i + 1];
+    } // for
+} // GLUArrayInterleave2x2
+
+// Scatter a packed attribute stream into consecutive vertices, with a
+// stride in floats
+static void GLUArrayInterleave(const GLuint& rCount,
+                               const GLuint& rComponents,
+                               const GLfloat * const pSrc,
+                               const size_t& rStride,
+                               GLfloat *pDst)
+{
+    GLuint i;
+    
+    if(rComponents == 4)
+    {
+        for(i = 0; i < rCount; ++i, pDst += rStride)
+        {
+#if defined(__SSE2__)
+            _mm_storeu_ps(pDst, _mm_loadu_ps(pSrc + 4 * i));
+#elif defined(__ARM_NEON)
+            vst1q_f32(pDst, vld1q_f32(pSrc + 4 * i));
+#else
+            std::memcpy(pDst, pSrc + 4 * i, 4 * sizeof(GLfloat));
+#endif
+        } // for
     } // if
     else
     {
-        pArray->m_Vertices.push_back(GLU::Vertex(vPositions, vTexCoords, vColors));
+        const GLfloat *p = pSrc;
+        
+        for(i = 0; i < rCount; ++i, p += rComponents, pDst += rStride)
+        {
+            for(GLuint j = 0; j < rComponents; ++j)
+            {
+                pDst[j] = p[j];
+            } // for
+        } // for
     } // else
-} //GLUVertexPushback
+} // GLUArrayInterleave
 
 #pragma mark -
-#pragma mark Public - Constructors
+#pragma mark Private - Utilities - Storage
 
-// Create an interleaved array for 2D objects
-GLU::ArrayRef GLU::ArrayCreate(const GLuint& rCount,
-                               const GLfloat * const pPositions,
-                               const GLfloat * const pTexCoords,
-                               const GLfloat * const pColors)
+// Point the array at caller-owned storage, or size its own backing store
+template <typename Layout>
+static bool GLUArrayAcquireStorage(const GLuint& rCount,
+                                   GLvoid *pStorage,
+                                   GLU::PackedArray<Layout> *pArray)
 {
-    GLU::ArrayRef pArray = NULL;
+    if(pStorage != nullptr)
+    {
+        if(uintptr_t(pStorage) % alignof(typename Layout::Vertex))
+        {
+            NSLog(@">> ERROR: OpenGL array storage is not aligned to %zu bytes!", alignof(typename Layout::Vertex));
+            
+            return false;
+        } // if
+        
+        pArray->mpVertices = static_cast<GLubyte *>(pStorage);
+    } // if
+    else
+    {
+        // One allocation, and the vertices are left uninitialized until
+        // they are interleaved
+        pArray->m_Vertices.resize(rCount);
+        
+        pArray->mpVertices = reinterpret_cast<GLubyte *>(pArray->m_Vertices.data());
+    } // else
+    
+    pArray->mnSize = rCount;
+    
+    return true;
+} // GLUArrayAcquireStorage
+
+// Interleave packed attribute streams, indexed by vertex attribute, into
+// an array of the given vertex layout
+template <typename Layout>
+static GLU::ArrayRef GLUArrayCreate(const GLuint& rCount,
+                                    const GLfloat * const * const pAttributes,
+                                    GLvoid *pStorage)
+{
+    GLU::PackedArray<Layout> *pArray = nullptr;
     
     if(rCount)
     {
         try
         {
-            pArray = new GLU::Array;
+            pArray = new GLU::PackedArray<Layout>;
             
-            GLuint i;
-            
-            for(i = 0; i < rCount; ++i)
+            if(!GLUArrayAcquireStorage(rCount, pStorage, pArray))
             {
-                GLUVertexPushback(i, pPositions, pTexCoords, pColors, pArray);
-            } // for
+                delete pArray;
+                
+                return nullptr;
+            } // if
+            
+            const size_t nStride = sizeof(typename Layout::Vertex) / sizeof(GLfloat);
             
-            pArray->mnDim = 2;
+            GLfloat *pDst = reinterpret_cast<GLfloat *>(pArray->mpVertices);
+            
+            GLuint i = GLU::kVertexPositions;
+            
+            // 2D positions and texture coordinates are adjacent, and are
+            // interleaved together
+            if(Layout::kDim == 2)
+            {
+                GLUArrayInterleave2x2(rCount,
+                                      pAttributes[GLU::kVertexPositions],
+                                      pAttributes[GLU::kVertexTexCoords],
+                                      nStride,
+                                      pDst);
+                
+                i = GLU::kVertexColors;
+            } // if
             
-            pArray->mnCount[0] = 2;		// positions
-            pArray->mnCount[1] = 0;		// normals
-            pArray->mnCount[2] = 2;		// texture coordinates
-            pArray->mnCount[3] = 4;		// colors
+            for(; i < GLU::kVertexAttributes; ++i)
+            {
+                if(Layout::kCount[i])
+                {
+                    GLUArrayInterleave(rCount,
+                                       Layout::kCount[i],
+                                       pAttributes[i],
+                                       nStride,
+                                       pDst + Layout::kOffset[i] / sizeof(GLfloat));
+                } // if
+            } // for
         } // try
         catch(std::bad_alloc& ba)
         {
             NSLog(@">> ERROR: Failed an OpenGL array reference backing store: \"%s\"", ba.what());
+            
+            delete pArray;
+            
+            pArray = nullptr;
         } // catch
     } // if
     
     return pArray;
+} // GLUArrayCreate
+
+// Interleave 2D positions, texture coordinates, and colors
+static GLU::ArrayRef GLUArrayCreate2D(const GLuint& rCount,
+                                      const GLfloat * const pPositions,
+                                      const GLfloat * const pTexCoords,
+                                      const GLfloat * const pColors,
+                                      GLvoid *pStorage)
+{
+    const GLfloat * const pAttributes[GLU::kVertexAttributes] =
+    {
+        pPositions, nullptr, pTexCoords, pColors
+    };
+    
+    return GLUArrayCreate<GLU::Layout2D>(rCount, pAttributes, pStorage);
+} // GLUArrayCreate2D
+
+// Interleave 3D positions, optional normals, texture coordinates, and colors
+static GLU::ArrayRef GLUArrayCreate3D(const GLuint& rCount,
+                                      const GLfloat * const pPositions,
+                                      const GLfloat * const pNormals,
+                                      const GLfloat * const pTexCoords,
+                                      const GLfloat * const pColors,
+                                      GLvoid *pStorage)
+{
+    const GLfloat * const pAttributes[GLU::kVertexAttributes] =
+    {
+        pPositions, pNormals, pTexCoords, pColors
+    };
+    
+    return (pNormals != nullptr)
+    ? GLUArrayCreate<GLU::Layout3DNormals>(rCount, pAttributes, pStorage)
+    : GLUArrayCreate<GLU::Layout3D>(rCount, pAttributes, pStorage);
+} // GLUArrayCreate3D
+
+#pragma mark -
+#pragma mark Private - Utilities - Accessors
+
+// Address of an attribute of a vertex
+static const GLfloat *GLUArrayGetAttribute(const GLuint& rIndex,
+                                           const GLU::VertexAttribute& rAttribute,
+                                           const GLU::ArrayRef pArray)
+{
+    const GLubyte *pVertex = pArray->mpVertices + GLsizeiptr(rIndex) * pArray->mnStride;
+    
+    return reinterpret_cast<const GLfloat *>(pVertex + pArray->mnOffset[rAttribute]);
+} // GLUArrayGetAttribute
+
+#pragma mark -
+#pragma mark Private - Utilities - Streams
+
+static_assert(int(GLU::kArrayPositions) == int(GLU::kVertexPositions), "Array attributes must match vertex attributes");
+static_assert(int(GLU::kArrayNormals)   == int(GLU::kVertexNormals),   "Array attributes must match vertex attributes");
+static_assert(int(GLU::kArrayTexCoords) == int(GLU::kVertexTexCoords), "Array attributes must match vertex attributes");
+static_assert(int(GLU::kArrayColors)    == int(GLU::kVertexColors),    "Array attributes must match vertex attributes");
+
+// Copy a strided stream into a packed buffer, with a fixed number of
+// components copied per vertex and the rest of the destination vertex
+// zero filled
+template <GLuint nCopy>
+static void GLUArrayCopyStream(const GLuint& rCount,
+                               const GLubyte *pSrc,
+                               const GLsizei& rStride,
+                               const GLuint& rComponents,
+                               GLfloat *pDst)
+{
+    GLuint i;
+    GLuint j;
+    
+    for(i = 0; i < rCount; ++i, pSrc += rStride, pDst += rComponents)
+    {
+        const GLfloat *p = reinterpret_cast<const GLfloat *>(pSrc);
+        
+        for(j = 0; j < nCopy; ++j)
+        {
+            pDst[j] = p[j];
+        } // for
+        
+        for(; j < rComponents; ++j)
+        {
+            pDst[j] = 0.0f;
+        } // for
+    } // for
+} // GLUArrayCopyStream
+
+// Bounds of a strided stream of positions, with a fixed dimension
+template <GLuint nDim>
+static void GLUArrayBoundsStream(const GLuint& rCount,
+                                 const GLubyte *pSrc,
+                                 const GLsizei& rStride,
+                                 GLfloat *pMin,
+                                 GLfloat *pMax)
+{
+    GLuint i;
+    GLuint j;
+    
+    for(i = 0; i < rCount; ++i, pSrc += rStride)
+    {
+        const GLfloat *p = reinterpret_cast<const GLfloat *>(pSrc);
+        
+        for(j = 0; j < nDim; ++j)
+        {
+            pMin[j] = (p[j] < pMin[j]) ? p[j] : pMin[j];
+            pMax[j] = (p[j] > pMax[j]) ? p[j] : pMax[j];
+        } // for
+    } // for
+} // GLUArrayBoundsStream
+
+#pragma mark -
+#pragma mark Public - Constructors
+
+// Create an interleaved array for 2D objects
+GLU::ArrayRef GLU::ArrayCreate(const GLuint& rCount,
+                               const GLfloat * const pPositions,
+                               const GLfloat * const pTexCoords,
+                               const GLfloat * const pColors)
+{
+    return GLUArrayCreate2D(rCount, pPositions, pTexCoords, pColors, nullptr);
 } // ArrayCreate
 
 // Create an interleaved vector for 3D objects
@@ -154,37 +373,34 @@ GLU::ArrayRef GLU::ArrayCreate(const GLuint& rCount,
                                const GLfloat * const pTexCoords,
                                const GLfloat * const pColors)
 {
-    GLU::ArrayRef pArray = NULL;
-    
-    if(rCount)
-    {
-        try
-        {
-            pArray = new GLU::Array;
-            
-            GLuint i;
-            
-            for(i = 0; i < rCount; ++i)
-            {
-                GLUVertexPushback(i, pPositions, pNormals, pTexCoords, pColors, pArray);
-            } // for
-            
-            pArray->mnDim = 3;
-            
-            pArray->mnCount[0] = 3;						// positions
-            pArray->mnCount[1] = (pNormals) ? 3 : 0;	// normals
-            pArray->mnCount[2] = 3;						// texture coordinates
-            pArray->mnCount[3] = 4;						// colors
-        } // try
-        catch(std::bad_alloc& ba)
-        {
-            NSLog(@">> ERROR: Failed an OpenGL array reference backing store: \"%s\"", ba.what());
-        } // catch
-    } // if
-    
-    return pArray;
+    return GLUArrayCreate3D(rCount, pPositions, pNormals, pTexCoords, pColors, nullptr);
 } // GLVerticesCreate
 
+// Create an interleaved array for 2D objects in caller-owned storage
+GLU::ArrayRef GLU::ArrayCreateWithStorage(const GLuint& rCount,
+                                          const GLfloat * const pPositions,
+                                          const GLfloat * const pTexCoords,
+                                          const GLfloat * const pColors,
+                                          GLvoid *pStorage)
+{
+    return (pStorage != nullptr)
+    ? GLUArrayCreate2D(rCount, pPositions, pTexCoords, pColors, pStorage)
+    : nullptr;
+} // ArrayCreateWithStorage
+
+// Create an interleaved array for 3D objects in caller-owned storage
+GLU::ArrayRef GLU::ArrayCreateWithStorage(const GLuint& rCount,
+                                          const GLfloat * const pPositions,
+                                          const GLfloat * const pNormals,
+                                          const GLfloat * const pTexCoords,
+                                          const GLfloat * const pColors,
+                                          GLvoid *pStorage)
+{
+    return (pStorage != nullptr)
+    ? GLUArrayCreate3D(rCount, pPositions, pNormals, pTexCoords, pColors, pStorage)
+    : nullptr;
+} // ArrayCreateWithStorage
+
 // Create an interleaved vector for a quad 2D object
 GLU::ArrayRef GLU::ArrayCreateQuad(const GLfloat * const pPositionsSrc,
                                    const GLfloat * const pTexCoordsSrc,
@@ -242,8 +458,6 @@ void GLU::ArrayDelete(GLU::ArrayRef pArray)
 {
     if(pArray != nullptr)
     {
-        pArray->m_Vertices.clear();
-        
         delete pArray;
     } // if
 } // ArrayDelete
@@ -254,28 +468,157 @@ void GLU::ArrayDelete(GLU::ArrayRef pArray)
 // The vertex count
 const GLuint GLU::ArrayGetCount(const GLU::ArrayRef pArray)
 {
-    return pArray->m_Vertices.size();
+    return pArray->mnSize;
 } // ArrayGetCount
 
-// Accessors for 2D positions in an interleaved array
-const vector_float2 GLU::ArrayGetPosition2D(const GLuint& rIndex,
-                                            const GLU::ArrayRef pArray)
+// Bytes between consecutive vertices
+const GLsizei GLU::ArrayGetStride(const GLU::ArrayRef pArray)
+{
+    return pArray->mnStride;
+} // ArrayGetStride
+
+// The vertex layout
+const GLU::ArrayLayout GLU::ArrayGetLayout(const GLU::ArrayRef pArray)
 {
-    vector_float2 position;
-    
     if(pArray->mnDim == 2)
     {
-        position = pArray->m_Vertices[rIndex].m_Vertex2D.m_Positions;
+        return GLU::kArrayLayout2D;
     } // if
-    else
+    
+    return (pArray->mnCount[GLU::kVertexNormals])
+    ? GLU::kArrayLayout3DNormals
+    : GLU::kArrayLayout3D;
+} // ArrayGetLayout
+
+// Bytes of storage for an interleaved array of the given vertex count
+const GLsizeiptr GLU::ArrayGetStorageSize(const GLU::ArrayLayout& rLayout,
+                                          const GLuint& rCount)
+{
+    GLsizeiptr nStride = 0;
+    
+    switch(rLayout)
+    {
+        case GLU::kArrayLayout2D:
+            nStride = sizeof(GLU::Layout2D::Vertex);
+            break;
+            
+        case GLU::kArrayLayout3D:
+            nStride = sizeof(GLU::Layout3D::Vertex);
+            break;
+            
+        case GLU::kArrayLayout3DNormals:
+            nStride = sizeof(GLU::Layout3DNormals::Vertex);
+            break;
+    } // switch
+    
+    return GLsizeiptr(rCount) * nStride;
+} // ArrayGetStorageSize
+
+// Alignment, in bytes, of storage for an interleaved array
+const GLsizeiptr GLU::ArrayGetStorageAlignment()
+{
+    return alignof(GLfloat);
+} // ArrayGetStorageAlignment
+
+// Strided view of an attribute of an interleaved array
+const GLU::ArraySpan GLU::ArrayGetSpan(const GLU::ArrayAttribute& rAttribute,
+                                       const GLU::ArrayRef pArray)
+{
+    GLU::ArraySpan span = {nullptr, 0, 0, 0};
+    
+    if((pArray != nullptr) && pArray->mnCount[rAttribute])
+    {
+        span.mpData       = GLUArrayGetAttribute(0, GLU::VertexAttribute(rAttribute), pArray);
+        span.mnCount      = pArray->mnSize;
+        span.mnComponents = pArray->mnCount[rAttribute];
+        span.mnStride     = pArray->mnStride;
+    } // if
+    
+    return span;
+} // ArrayGetSpan
+
+// Copy a range of an attribute into a packed buffer
+const GLuint GLU::ArrayCopyAttribute(const GLU::ArrayAttribute& rAttribute,
+                                     const GLuint& rFirst,
+                                     const GLuint& rCount,
+                                     const GLuint& rComponents,
+                                     GLfloat *pDst,
+                                     const GLU::ArrayRef pArray)
+{
+    const GLU::ArraySpan span = GLU::ArrayGetSpan(rAttribute, pArray);
+    
+    if((span.mpData == nullptr) || (pDst == nullptr) || (rFirst >= span.mnCount) || !rComponents)
+    {
+        return 0;
+    } // if
+    
+    const GLuint   nCount = std::min(rCount, span.mnCount - rFirst);
+    const GLubyte *pSrc   = reinterpret_cast<const GLubyte *>(span.mpData) + GLsizeiptr(rFirst) * span.mnStride;
+    
+    // The layout and conversion are resolved once, for the whole range
+    switch(std::min(span.mnComponents, rComponents))
     {
-        vector_float3 position3D = (pArray->mnCount[1])
-        ? pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_2.m_Positions
-        : pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_1.m_Positions;
+        case 1:
+            GLUArrayCopyStream<1>(nCount, pSrc, span.mnStride, rComponents, pDst);
+            break;
+            
+        case 2:
+            GLUArrayCopyStream<2>(nCount, pSrc, span.mnStride, rComponents, pDst);
+            break;
+            
+        case 3:
+            GLUArrayCopyStream<3>(nCount, pSrc, span.mnStride, rComponents, pDst);
+            break;
+            
+        default:
+            GLUArrayCopyStream<4>(nCount, pSrc, span.mnStride, rComponents, pDst);
+            break;
+    } // switch
+    
+    return nCount;
+} // ArrayCopyAttribute
+
+// Axis aligned bounds of the positions
+const bool GLU::ArrayGetBounds(vector_float3& rMin,
+                               vector_float3& rMax,
+                               const GLU::ArrayRef pArray)
+{
+    const GLU::ArraySpan span = GLU::ArrayGetSpan(GLU::kArrayPositions, pArray);
+    
+    bool bSuccess = (span.mpData != nullptr) && span.mnCount;
+    
+    if(bSuccess)
+    {
+        GLfloat min[3] = {span.mpData[0], span.mpData[1], 0.0f};
+        GLfloat max[3] = {span.mpData[0], span.mpData[1], 0.0f};
         
-        position.x = position3D.x;
-        position.y = position3D.y;
-    } // else
+        const GLubyte *pSrc = reinterpret_cast<const GLubyte *>(span.mpData);
+        
+        if(span.mnComponents == 3)
+        {
+            min[2] = max[2] = span.mpData[2];
+            
+            GLUArrayBoundsStream<3>(span.mnCount, pSrc, span.mnStride, min, max);
+        } // if
+        else
+        {
+            GLUArrayBoundsStream<2>(span.mnCount, pSrc, span.mnStride, min, max);
+        } // else
+        
+        rMin.x = min[0]; rMin.y = min[1]; rMin.z = min[2];
+        rMax.x = max[0]; rMax.y = max[1]; rMax.z = max[2];
+    } // if
+    
+    return bSuccess;
+} // ArrayGetBounds
+
+// Accessors for 2D positions in an interleaved array
+const vector_float2 GLU::ArrayGetPosition2D(const GLuint& rIndex,
+                                            const GLU::ArrayRef pArray)
+{
+    const GLfloat *pPosition = GLUArrayGetAttribute(rIndex, GLU::kVertexPositions, pArray);
+    
+    vector_float2 position = {pPosition[0], pPosition[1]};
     
     return position;
 } // ArrayGetPosition2D
@@ -284,21 +627,9 @@ const vector_float2 GLU::ArrayGetPosition2D(const GLuint& rIndex,
 const vector_float2 GLU::ArrayGetTexCoords2D(const GLuint& rIndex,
                                              const GLU::ArrayRef pArray)
 {
-    vector_float2 texcoords;
+    const GLfloat *pTexCoords = GLUArrayGetAttribute(rIndex, GLU::kVertexTexCoords, pArray);
     
-    if(pArray->mnDim == 2)
-    {
-        texcoords = pArray->m_Vertices[rIndex].m_Vertex2D.m_Texcoords;
-    } // if
-    else
-    {
-        vector_float3 texcoords3D = (pArray->mnCount[1])
-        ? pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_2.m_Texcoords
-        : pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_1.m_Texcoords;
-        
-        texcoords.x = texcoords3D.x;
-        texcoords.y = texcoords3D.y;
-    } // else
+    vector_float2 texcoords = {pTexCoords[0], pTexCoords[1]};
     
     return texcoords;
 } // ArrayGetTexCoords2D
@@ -307,22 +638,13 @@ const vector_float2 GLU::ArrayGetTexCoords2D(const GLuint& rIndex,
 const vector_float3 GLU::ArrayGetPosition3D(const GLuint& rIndex,
                                             const GLU::ArrayRef pArray)
 {
+    const GLfloat *pPosition = GLUArrayGetAttribute(rIndex, GLU::kVertexPositions, pArray);
+    
     vector_float3 position;
     
-    if(pArray->mnDim == 3)
-    {
-        position = (pArray->mnCount[1])
-        ? pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_2.m_Positions
-        : pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_1.m_Positions;
-    } // if
-    else
-    {
-        vector_float2 position2D = pArray->m_Vertices[rIndex].m_Vertex2D.m_Positions;
-        
-        position.x = position2D.x;
-        position.y = position2D.y;
-        position.z = 0.0f;
-    } // else
+    position.x = pPosition[0];
+    position.y = pPosition[1];
+    position.z = (pArray->mnDim == 3) ? pPosition[2] : 0.0f;
     
     return position;
 } // ArrayGetPosition3D
@@ -333,9 +655,13 @@ const vector_float3 GLU::ArrayGetNormals3D(const GLuint& rIndex,
 {
     vector_float3 normals = {-1.0f,-1.0f,-1.0f};
     
-    if((pArray->mnDim == 3) && (pArray->mnCount[1] == 3))
+    if(pArray->mnCount[GLU::kVertexNormals] == 3)
     {
-        normals = pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_2.m_Normals;
+        const GLfloat *pNormals = GLUArrayGetAttribute(rIndex, GLU::kVertexNormals, pArray);
+        
+        normals.x = pNormals[0];
+        normals.y = pNormals[1];
+        normals.z = pNormals[2];
     } // if
     
     return normals;
@@ -345,22 +671,13 @@ const vector_float3 GLU::ArrayGetNormals3D(const GLuint& rIndex,
 const vector_float3 GLU::ArrayGetTexCoords3D(const GLuint& rIndex,
                                              const ArrayRef pArray)
 {
+    const GLfloat *pTexCoords = GLUArrayGetAttribute(rIndex, GLU::kVertexTexCoords, pArray);
+    
     vector_float3 texcoords;
     
-    if(pArray->mnDim == 3)
-    {
-        texcoords = (pArray->mnCount[1])
-        ? pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_2.m_Texcoords
-        : pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_1.m_Texcoords;
-    } // if
-    else
-    {
-        vector_float2 texcoords2D = pArray->m_Vertices[rIndex].m_Vertex2D.m_Texcoords;
-        
-        texcoords.x = texcoords2D.x;
-        texcoords.y = texcoords2D.y;
-        texcoords.z = 0.0f;
-    } // else
+    texcoords.x = pTexCoords[0];
+    texcoords.y = pTexCoords[1];
+    texcoords.z = (pArray->mnDim == 3) ? pTexCoords[2] : 0.0f;
     
     return texcoords;
 } // ArrayGetTexCoords3D
@@ -369,18 +686,9 @@ const vector_float3 GLU::ArrayGetTexCoords3D(const GLuint& rIndex,
 const vector_float4 GLU::ArrayGetColors(const GLuint& rIndex,
                                         const GLU::ArrayRef pArray)
 {
-    vector_float4 colors;
+    const GLfloat *pColors = GLUArrayGetAttribute(rIndex, GLU::kVertexColors, pArray);
     
-    if(pArray->mnDim == 2)
-    {
-        colors = pArray->m_Vertices[rIndex].m_Vertex2D.m_Colors;
-    } // if
-    else
-    {
-        colors = (pArray->mnCount[1])
-        ? pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_2.m_Colors
-        : pArray->m_Vertices[rIndex].m_Vertex3D.m_v3D_1.m_Colors;
-    } // else
+    vector_float4 colors = {pColors[0], pColors[1], pColors[2], pColors[3]};
     
     return colors;
 } // ArrayGetColors
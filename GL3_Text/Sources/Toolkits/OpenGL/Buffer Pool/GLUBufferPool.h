@@ -0,0 +1,69 @@
+/*
+     File: GLUBufferPool.h
+ Abstract:
+ Utility toolkit for suballocating vertex buffers.
+
+ A pool serves vertices of one stride out of large buffer slabs, with a
+ buddy allocator counting in vertices.  Every range therefore starts at a
+ vertex index of its slab, so many small meshes share one buffer and are
+ drawn with glDrawArrays from their first vertex.
+
+ */
+
+// MacOS X
+
+#ifndef _GL_UTILITIES_BUFFER_POOL_H_
+#define _GL_UTILITIES_BUFFER_POOL_H_
+
+// OpenGL Mac OS X
+#import <OpenGL/OpenGL.h>
+
+#ifdef __cplusplus
+
+namespace GLU
+{
+    // Opaque data reference to a buffer pool, see GLUVertexArray.h
+    typedef struct BufferPool *BufferPoolRef;
+
+    // Range of vertices suballocated from a slab
+    struct BufferRange
+    {
+        GLuint  mnBID;      // Buffer object of the slab
+        GLuint  mnSlab;     // Slab index in the pool
+        GLuint  mnFirst;    // First vertex in the slab
+        GLuint  mnOrder;    // Block of 2^mnOrder vertices
+    }; // BufferRange
+
+    typedef struct BufferRange  BufferRange;
+
+    // Create a pool of vertices with the given stride in bytes.  Slabs hold
+    // rCapacity vertices, rounded up to a power of two.
+    BufferPoolRef BufferPoolCreate(const GLsizei& rStride,
+                                   const GLuint& rCapacity);
+
+    // Delete the pool and its slabs
+    void BufferPoolDelete(BufferPoolRef pPool);
+
+    // Suballocate rCount vertices, adding a slab if none has room.  Fails if
+    // rCount exceeds the slab capacity.
+    bool BufferPoolAllocate(const GLuint& rCount,
+                            BufferRange& rRange,
+                            BufferPoolRef pPool);
+
+    // Return a range to the pool
+    void BufferPoolFree(const BufferRange& rRange,
+                        BufferPoolRef pPool);
+
+    // Upload rCount vertices into a range
+    void BufferPoolUpload(const BufferRange& rRange,
+                          const GLuint& rCount,
+                          const GLvoid * const pVertices,
+                          const BufferPoolRef pPool);
+
+    // The number of vertices in a slab
+    const GLuint BufferPoolGetCapacity(const BufferPoolRef pPool);
+} // GLU
+
+#endif
+
+#endif
@@ -0,0 +1,306 @@
+/*
+     File: GLUBufferPool.mm
+ Abstract:
+ Utility toolkit for suballocating vertex buffers.
+
+ */
+
+#pragma mark -
+#pragma mark Headers
+
+// STL container types and algorithms
+#import <algorithm>
+#import <vector>
+
+// Mac OS X frameworks
+#import <Cocoa/Cocoa.h>
+
+// OpenGL core profile
+#import <OpenGL/gl3.h>
+
+// OpenGL buffer pool header
+#import "GLUBufferPool.h"
+
+#pragma mark -
+#pragma mark Private - Constants
+
+// Smallest block, 4 vertices, so quads do not split blocks any further
+static const GLuint kBufferPoolMinOrder = 2;
+
+// Largest slab, 2^20 vertices
+static const GLuint kBufferPoolMaxOrder = 20;
+
+#pragma mark -
+#pragma mark Private - Data Structures
+
+namespace GLU
+{
+    // Free block offsets, in vertices, for each block order
+    typedef std::vector<GLuint>  BufferBlocks;
+
+    struct BufferSlab
+    {
+        GLuint  mnBID;
+
+        std::vector<BufferBlocks>  m_Free;
+    }; // BufferSlab
+
+    typedef struct BufferSlab  BufferSlab;
+
+    struct BufferPool
+    {
+        GLsizei  mnStride;      // Bytes per vertex
+        GLuint   mnOrder;       // Slabs of 2^mnOrder vertices
+
+        std::vector<BufferSlab>  m_Slabs;
+    }; // BufferPool
+
+    typedef struct BufferPool  BufferPool;
+} // GLU
+
+#pragma mark -
+#pragma mark Private - Utilities
+
+// Order of the smallest block holding the vertex count
+static GLuint GLUBufferPoolGetOrder(const GLuint& rCount)
+{
+    GLuint nOrder = kBufferPoolMinOrder;
+
+    while((nOrder < 32) && ((1u << nOrder) < rCount))
+    {
+        ++nOrder;
+    } // while
+
+    return nOrder;
+} // GLUBufferPoolGetOrder
+
+// Add an empty slab, a single free block of the slab's order
+static bool GLUBufferPoolAddSlab(GLU::BufferPoolRef pPool)
+{
+    GLU::BufferSlab slab;
+
+    slab.mnBID = 0;
+
+    glGenBuffers(1, &slab.mnBID);
+
+    if(!slab.mnBID)
+    {
+        return false;
+    } // if
+
+    const GLsizeiptr nSize = GLsizeiptr(1u << pPool->mnOrder) * pPool->mnStride;
+
+    glBindBuffer(GL_ARRAY_BUFFER, slab.mnBID);
+    glBufferData(GL_ARRAY_BUFFER, nSize, nullptr, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    slab.m_Free.resize(pPool->mnOrder + 1);
+    slab.m_Free[pPool->mnOrder].push_back(0);
+
+    pPool->m_Slabs.push_back(slab);
+
+    return true;
+} // GLUBufferPoolAddSlab
+
+// Take a block of the order from a slab, splitting a larger free block
+// if needed
+static bool GLUBufferPoolSplit(const GLuint& rOrder,
+                               GLU::BufferSlab& rSlab,
+                               GLuint& rFirst)
+{
+    GLuint nOrder = rOrder;
+    GLuint nMax   = GLuint(rSlab.m_Free.size()) - 1;
+
+    while((nOrder <= nMax) && rSlab.m_Free[nOrder].empty())
+    {
+        ++nOrder;
+    } // while
+
+    if(nOrder > nMax)
+    {
+        return false;
+    } // if
+
+    rFirst = rSlab.m_Free[nOrder].back();
+
+    rSlab.m_Free[nOrder].pop_back();
+
+    // Free the upper buddy at each split
+    while(nOrder > rOrder)
+    {
+        --nOrder;
+
+        rSlab.m_Free[nOrder].push_back(rFirst + (1u << nOrder));
+    } // while
+
+    return true;
+} // GLUBufferPoolSplit
+
+#pragma mark -
+#pragma mark Public - Constructor
+
+// Create a pool of vertices with the given stride
+GLU::BufferPoolRef GLU::BufferPoolCreate(const GLsizei& rStride,
+                                         const GLuint& rCapacity)
+{
+    GLU::BufferPoolRef pPool = nullptr;
+
+    if(rStride > 0)
+    {
+        try
+        {
+            pPool = new GLU::BufferPool;
+
+            pPool->mnStride = rStride;
+            pPool->mnOrder  = std::min(GLUBufferPoolGetOrder(rCapacity), kBufferPoolMaxOrder);
+        } // try
+        catch(std::bad_alloc& ba)
+        {
+            NSLog(@">> ERROR: Failed allocating memory for buffer pool backing store: \"%s\"", ba.what());
+
+            pPool = nullptr;
+        } // catch
+    } // if
+
+    return pPool;
+} // GLUBufferPoolCreate
+
+#pragma mark -
+#pragma mark Public - Destructor
+
+// Delete the pool and its slabs
+void GLU::BufferPoolDelete(GLU::BufferPoolRef pPool)
+{
+    if(pPool != nullptr)
+    {
+        for(GLU::BufferSlab& slab : pPool->m_Slabs)
+        {
+            glDeleteBuffers(1, &slab.mnBID);
+        } // for
+
+        delete pPool;
+    } // if
+} // GLUBufferPoolDelete
+
+#pragma mark -
+#pragma mark Public - Allocation
+
+// Suballocate a range of vertices
+bool GLU::BufferPoolAllocate(const GLuint& rCount,
+                             GLU::BufferRange& rRange,
+                             GLU::BufferPoolRef pPool)
+{
+    if((pPool == nullptr) || !rCount)
+    {
+        return false;
+    } // if
+
+    const GLuint nOrder = GLUBufferPoolGetOrder(rCount);
+
+    if(nOrder > pPool->mnOrder)
+    {
+        return false;
+    } // if
+
+    try
+    {
+        GLuint nSlab = 0;
+        GLuint nSlabs = GLuint(pPool->m_Slabs.size());
+
+        for(nSlab = 0; nSlab < nSlabs; ++nSlab)
+        {
+            if(GLUBufferPoolSplit(nOrder, pPool->m_Slabs[nSlab], rRange.mnFirst))
+            {
+                break;
+            } // if
+        } // for
+
+        if(nSlab == nSlabs)
+        {
+            if(!GLUBufferPoolAddSlab(pPool))
+            {
+                return false;
+            } // if
+
+            GLUBufferPoolSplit(nOrder, pPool->m_Slabs[nSlab], rRange.mnFirst);
+        } // if
+
+        rRange.mnBID   = pPool->m_Slabs[nSlab].mnBID;
+        rRange.mnSlab  = nSlab;
+        rRange.mnOrder = nOrder;
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for buffer pool free lists: \"%s\"", ba.what());
+
+        return false;
+    } // catch
+
+    return true;
+} // GLUBufferPoolAllocate
+
+// Return a range to the pool, merging it with its free buddies
+void GLU::BufferPoolFree(const GLU::BufferRange& rRange,
+                         GLU::BufferPoolRef pPool)
+{
+    if((pPool != nullptr) && (rRange.mnSlab < pPool->m_Slabs.size()))
+    {
+        GLU::BufferSlab& rSlab = pPool->m_Slabs[rRange.mnSlab];
+
+        GLuint nFirst = rRange.mnFirst;
+        GLuint nOrder = rRange.mnOrder;
+
+        while(nOrder < pPool->mnOrder)
+        {
+            GLU::BufferBlocks& rFree = rSlab.m_Free[nOrder];
+
+            const GLuint nBuddy = nFirst ^ (1u << nOrder);
+
+            GLU::BufferBlocks::iterator pBuddy = std::find(rFree.begin(), rFree.end(), nBuddy);
+
+            if(pBuddy == rFree.end())
+            {
+                break;
+            } // if
+
+            rFree.erase(pBuddy);
+
+            nFirst = std::min(nFirst, nBuddy);
+
+            ++nOrder;
+        } // while
+
+        rSlab.m_Free[nOrder].push_back(nFirst);
+    } // if
+} // GLUBufferPoolFree
+
+#pragma mark -
+#pragma mark Public - Upload
+
+// Upload vertices into a range
+void GLU::BufferPoolUpload(const GLU::BufferRange& rRange,
+                           const GLuint& rCount,
+                           const GLvoid * const pVertices,
+                           const GLU::BufferPoolRef pPool)
+{
+    if((pPool != nullptr) && (pVertices != nullptr) && rCount)
+    {
+        const GLuint nCount = std::min(rCount, 1u << rRange.mnOrder);
+
+        glBindBuffer(GL_ARRAY_BUFFER, rRange.mnBID);
+        glBufferSubData(GL_ARRAY_BUFFER,
+                        GLintptr(rRange.mnFirst) * pPool->mnStride,
+                        GLsizeiptr(nCount) * pPool->mnStride,
+                        pVertices);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    } // if
+} // GLUBufferPoolUpload
+
+#pragma mark -
+#pragma mark Public - Accessors
+
+// The number of vertices in a slab
+const GLuint GLU::BufferPoolGetCapacity(const GLU::BufferPoolRef pPool)
+{
+    return 1u << pPool->mnOrder;
+} // GLUBufferPoolGetCapacity
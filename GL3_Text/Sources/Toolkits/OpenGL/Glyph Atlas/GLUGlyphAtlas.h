@@ -0,0 +1,145 @@
+/*
+     File: GLUGlyphAtlas.h
+ Abstract:
+ Utility toolkit for rasterizing glyphs into shared atlas textures of
+ signed distance fields.
+
+ Each glyph is rasterized once per font and field size into a signed
+ distance field in a page of a single-channel atlas, shared by the
+ contexts of a share group.  The field size is the power of two at or
+ above the em of the font on screen in pixels.  The fields of the glyphs
+ new to a string are generated concurrently.
+
+ Strings are laid out with CoreText into glyph quads referencing the
+ atlas, so creating or changing a string only rasterizes glyphs never
+ seen before.  Texture memory tracks the set of glyphs and their size on
+ screen, not the length of the strings or the font size they were
+ requested at.
+
+ Texels hold the distance to the outline, 0.5 on it and increasing
+ inwards, swizzled to all four channels, and shaders threshold it over
+ the width of a pixel.
+
+ Laying out a string and generating the fields of its new glyphs may run
+ on any thread.  Committing the layout, which uploads the fields through a
+ pixel buffer and gets its quads, runs on the thread owning the context.
+
+ An atlas holds up to 8 pages.  When a commit finds it full, the atlas is
+ reset: its pages are deleted, its glyphs are cleared and the commit packs
+ its glyphs into an empty atlas.  The generation of the atlas counts the
+ resets, and quads laid out at an earlier generation must be laid out
+ again, as their glyphs moved.
+
+ */
+
+// MacOS X
+
+#ifndef _GL_UTILITIES_GLYPH_ATLAS_H_
+#define _GL_UTILITIES_GLYPH_ATLAS_H_
+
+// Mac OS X frameworks
+#import <Cocoa/Cocoa.h>
+#import <OpenGL/OpenGL.h>
+
+// OpenGL container types
+#import "GLUContainers.h"
+
+#ifdef __cplusplus
+
+namespace GLU
+{
+    // Opaque data reference to the shared glyph atlas
+    typedef struct GlyphAtlas *GlyphAtlasRef;
+
+    // Opaque data reference to a string laid out, waiting to be committed
+    typedef struct GlyphLayout *GlyphLayoutRef;
+
+    // A glyph of a laid out string, with its bounds in points from the
+    // bottom-left corner of the string's frame, y up.  Texture coordinates
+    // are { s, t } of the bottom-left and of the top-right corners.
+    struct GlyphQuad
+    {
+        CGRect   m_Bounds;          // Bounds in the frame
+        GLfloat  m_TexCoords[4];    // Texture coordinates in the page
+        GLfloat  m_Color[4];        // Foreground color of the run, white if none
+        GLuint   mnPage;            // Atlas page
+    }; // GlyphQuad
+
+    typedef struct GlyphQuad  GlyphQuad;
+
+    typedef vector<GlyphQuad>  GlyphQuads;
+
+    // Acquire the glyph atlas shared by the contexts in the share group of
+    // the current context, created with its first consumer
+    GlyphAtlasRef GlyphAtlasAcquire();
+
+    // Release the shared glyph atlas, deleting its pages with its last
+    // consumer.  A context of its share group must be current.
+    void GlyphAtlasRelease(GlyphAtlasRef pAtlas);
+
+    // Lay out an attributed string, and generate the distance fields of its
+    // new glyphs, on any thread.  Glyphs are rasterized for a number of
+    // screen pixels per point, or at the default field size if it is 0.
+    GlyphLayoutRef GlyphAtlasLayoutCreate(CFAttributedStringRef pAttrString,
+                                          const CGFloat& rScale,
+                                          GlyphAtlasRef pAtlas);
+
+    // Lay out a core foundation string, using a font, at a size, with an
+    // alignment, on any thread.  If the font name is null it defaults to
+    // Helvetica.
+    GlyphLayoutRef GlyphAtlasLayoutCreate(CFStringRef pString,
+                                          CFStringRef pFontName,
+                                          const CGFloat& rFontSize,
+                                          const CTTextAlignment& rAlignment,
+                                          const CGFloat& rScale,
+                                          GlyphAtlasRef pAtlas);
+
+    // Add the new glyphs of a layout to the atlas, and get its glyph quads
+    // and the CoreText suggested size of its frame, on the thread owning
+    // the context.  A full atlas is reset first, see the generation.
+    bool GlyphAtlasLayoutCommit(GlyphLayoutRef pLayout,
+                                NSSize& rSize,
+                                GlyphQuads& rQuads,
+                                GlyphAtlasRef pAtlas);
+
+    // Delete a layout, committed or not
+    void GlyphAtlasLayoutDelete(GlyphLayoutRef pLayout);
+
+    // Lay out an attributed string, rasterizing its new glyphs, and get its
+    // glyph quads and the CoreText suggested size of its frame
+    bool GlyphAtlasLayout(CFAttributedStringRef pAttrString,
+                          NSSize& rSize,
+                          GlyphQuads& rQuads,
+                          const CGFloat& rScale,
+                          GlyphAtlasRef pAtlas);
+
+    // Lay out a core foundation string, using a font, at a size, with an
+    // alignment.  If the font name is null it defaults to Helvetica.
+    bool GlyphAtlasLayout(CFStringRef pString,
+                          CFStringRef pFontName,
+                          const CGFloat& rFontSize,
+                          const CTTextAlignment& rAlignment,
+                          NSSize& rSize,
+                          GlyphQuads& rQuads,
+                          const CGFloat& rScale,
+                          GlyphAtlasRef pAtlas);
+
+    // Get the distance field size, in pixels per em, that glyphs of a font
+    // covering a number of pixels per em on screen are rasterized at
+    const GLuint GlyphAtlasGetFieldSize(const CGFloat& rPixels);
+
+    // Get the texture id of an atlas page
+    const GLuint GlyphAtlasGetTexture(const GLuint& rPage,
+                                      const GlyphAtlasRef pAtlas);
+
+    // Get the number of atlas pages
+    const GLuint GlyphAtlasGetPageCount(const GlyphAtlasRef pAtlas);
+
+    // Get the number of times the atlas was reset.  Quads laid out at an
+    // earlier generation sample glyphs that are no longer there.
+    const GLuint GlyphAtlasGetGeneration(const GlyphAtlasRef pAtlas);
+} // GLU
+
+#endif
+
+#endif
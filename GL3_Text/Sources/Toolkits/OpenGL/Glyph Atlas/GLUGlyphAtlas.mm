@@ -0,0 +1,1372 @@
+/*
+     File: GLUGlyphAtlas.mm
+ Abstract:
+ Utility toolkit for rasterizing glyphs into shared atlas textures of
+ signed distance fields.
+
+ */
+
+#pragma mark -
+#pragma mark Headers
+
+// C math functions
+#import <cmath>
+
+// STL containers
+#import <algorithm>
+#import <iterator>
+#import <unordered_map>
+#import <vector>
+
+// STL mutex, for laying out strings on other threads
+#import <mutex>
+
+// Grand Central Dispatch, for generating distance fields in parallel
+#import <dispatch/dispatch.h>
+
+// OpenGL core profile
+#import <OpenGL/gl3.h>
+
+// OpenGL glyph atlas header
+#import "GLUGlyphAtlas.h"
+
+#pragma mark -
+#pragma mark Private - Constants
+
+namespace GLU
+{
+    // Pages are square, single-channel textures of 1 MB
+    static const GLuint kGlyphAtlasPageSize = 1024;
+
+    // Texture memory is bounded to 8 pages
+    static const GLuint kGlyphAtlasPageMax = 8;
+
+    // Glyphs are rasterized once per font and field size into signed
+    // distance fields, scaled to any font size and zoom.  Field sizes are
+    // the power of two em in pixels at or above the footprint of the font
+    // on screen, from 32 to 128 pixels, and 64 pixels when it is unknown.
+    static const GLuint kGlyphAtlasFieldMin  = 32;
+    static const GLuint kGlyphAtlasFieldMax  = 128;
+    static const GLuint kGlyphAtlasFieldSize = 64;
+
+    // Distance fields reach 8 pixels either side of the outline, which
+    // also keeps linear filtering from bleeding neighbours in
+    static const GLuint kGlyphAtlasSpread = 8;
+
+    // Squared distance to an outline that is not in the glyph
+    static const GLfloat kGlyphAtlasFar = 1.0e20f;
+} // GLU
+
+#pragma mark -
+#pragma mark Private - Data Structures
+
+namespace GLU
+{
+    // A glyph rasterized in the atlas
+    struct Glyph
+    {
+        GLfloat  m_Bounds[4];       // { x, y, width, height } from the glyph origin, in field pixels
+        GLfloat  m_TexCoords[4];    // { s, t } of the bottom-left and of the top-right corners
+        GLuint   mnPage;            // Atlas page
+        bool     mbEmpty;           // No coverage, as for a space
+    }; // Glyph
+
+    typedef struct Glyph  Glyph;
+
+    // A font at a distance field size, and its rasterized glyphs
+    struct GlyphFace
+    {
+        CTFontRef                           mpFont;     // Font at the field size
+        CGFloat                             mnSize;     // Field size
+        std::unordered_map<CGGlyph, Glyph>  m_Glyphs;   // Rasterized glyphs
+    }; // GlyphFace
+
+    typedef struct GlyphFace  GlyphFace;
+
+    // A glyph new to its face, whose distance field is generated on a
+    // worker thread before it is packed into a page
+    struct GlyphField
+    {
+        GlyphFace             *mpFace;      // Face the glyph is added to
+        CGGlyph                mnGlyph;
+        GLuint                 mnWidth;     // Field size, in texels
+        GLuint                 mnHeight;
+        GLuint                 mnX;         // Position in its page
+        GLuint                 mnY;
+        GLintptr               mnOffset;    // Offset in the pixel buffer
+        bool                   mbFailed;    // Out of memory, or no bitmap context
+        bool                   mbUpload;    // Packed by this commit
+        Glyph                  m_Glyph;     // Bounds, and emptiness
+        std::vector<GLubyte>   m_Field;     // Distance to the outline, 0.5 on it
+    }; // GlyphField
+
+    typedef struct GlyphField  GlyphField;
+
+    // The glyphs of a laid out run, positioned from its line origin
+    struct GlyphRun
+    {
+        GlyphFace             *mpFace;
+        CGPoint                m_Origin;    // Line origin
+        CGFloat                mnScale;     // Font size over the field size
+        GLfloat                m_Color[4];  // Foreground color, white if none
+        std::vector<CGGlyph>   m_Glyphs;
+        std::vector<CGPoint>   m_Positions;
+    }; // GlyphRun
+
+    typedef struct GlyphRun  GlyphRun;
+
+    // A string laid out on any thread, with the distance fields of its new
+    // glyphs, waiting to be committed on the thread owning the context
+    struct GlyphLayout
+    {
+        NSSize                   m_Size;     // CoreText suggested frame size
+        GLuint                   mnGeneration; // Resets of the atlas when laid out
+        std::vector<GlyphRun>    m_Runs;
+        std::vector<GlyphField>  m_Fields;
+    }; // GlyphLayout
+
+    // Faces are added, and glyphs are looked up, by layouts on any thread,
+    // under the mutex.  Glyphs are only added, or cleared by a reset, by
+    // commits on the thread owning the context, which reads them without
+    // it.  Faces are never removed, so layouts may keep pointers to them.
+    struct GlyphAtlas
+    {
+        CGLShareGroupObj                       mpShareGroup; // Contexts the pages are valid in
+        GLuint                                 mnRefs;      // Consumers
+        GLuint                                 mnX;         // Next free column of the shelf
+        GLuint                                 mnY;         // First row of the shelf
+        GLuint                                 mnShelf;     // Height of the shelf
+        GLuint                                 mnPBO;       // Pixel buffer the fields are uploaded through
+        GLuint                                 mnGeneration; // Resets, read by layouts under the mutex
+        bool                                   mbFull;      // The last page allocation was refused
+        std::vector<GLuint>                    m_Pages;     // Texture ids, glyphs are added to the last
+        std::unordered_map<String, GlyphFace>  m_Faces;     // Keyed by PostScript name and field size
+        std::vector<GLubyte>                   m_Coverage;  // Scratch bitmap of a page
+        std::mutex                             m_Mutex;     // Guards faces against other threads
+    }; // GlyphAtlas
+
+    typedef struct GlyphAtlas  GlyphAtlas;
+
+    // Where the shelves of an atlas stood before a commit packed its glyphs
+    struct GlyphShelf
+    {
+        GLuint  mnX;
+        GLuint  mnY;
+        GLuint  mnShelf;
+        size_t  mnPages;
+    }; // GlyphShelf
+
+    typedef struct GlyphShelf  GlyphShelf;
+
+    // The atlases of every share group, one for most applications
+    static std::vector<GlyphAtlas *> gGlyphAtlases;
+} // GLU
+
+#pragma mark -
+#pragma mark Private - Utilities - Pages
+
+// Create a page, cleared to the distance farthest outside the glyphs, so
+// filtering at the edges of their fields only reads empty texels
+static GLuint GLUGlyphAtlasCreatePage(GLU::GlyphAtlas *pAtlas)
+{
+    GLuint nTID = 0;
+
+    glGenTextures(1, &nTID);
+
+    if(nTID)
+    {
+        const GLint swizzle[4] = {GL_RED, GL_RED, GL_RED, GL_RED};
+
+        pAtlas->m_Coverage.assign(GLU::kGlyphAtlasPageSize * GLU::kGlyphAtlasPageSize, 0);
+
+        glBindTexture(GL_TEXTURE_2D, nTID);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        // Sample the distance in every channel
+        glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        glTexImage2D(GL_TEXTURE_2D,
+                     0,
+                     GL_R8,
+                     GLU::kGlyphAtlasPageSize,
+                     GLU::kGlyphAtlasPageSize,
+                     0,
+                     GL_RED,
+                     GL_UNSIGNED_BYTE,
+                     pAtlas->m_Coverage.data());
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+    } // if
+
+    return nTID;
+} // GLUGlyphAtlasCreatePage
+
+// Allocate a rectangle on the shelf of the last page, starting a new shelf
+// or a new page when it does not fit
+static bool GLUGlyphAtlasAllocate(const GLuint& rWidth,
+                                  const GLuint& rHeight,
+                                  GLuint& rX,
+                                  GLuint& rY,
+                                  GLuint& rPage,
+                                  GLU::GlyphAtlas *pAtlas)
+{
+    if((rWidth > GLU::kGlyphAtlasPageSize) || (rHeight > GLU::kGlyphAtlasPageSize))
+    {
+        return false;
+    } // if
+
+    if(!pAtlas->m_Pages.empty() && ((pAtlas->mnX + rWidth) > GLU::kGlyphAtlasPageSize))
+    {
+        pAtlas->mnX      = 0;
+        pAtlas->mnY     += pAtlas->mnShelf;
+        pAtlas->mnShelf  = 0;
+    } // if
+
+    if(pAtlas->m_Pages.empty() || ((pAtlas->mnY + rHeight) > GLU::kGlyphAtlasPageSize))
+    {
+        if(pAtlas->m_Pages.size() == GLU::kGlyphAtlasPageMax)
+        {
+            pAtlas->mbFull = true;
+
+            return false;
+        } // if
+
+        const GLuint nTID = GLUGlyphAtlasCreatePage(pAtlas);
+
+        if(!nTID)
+        {
+            return false;
+        } // if
+
+        pAtlas->m_Pages.push_back(nTID);
+
+        pAtlas->mnX     = 0;
+        pAtlas->mnY     = 0;
+        pAtlas->mnShelf = 0;
+    } // if
+
+    rX    = pAtlas->mnX;
+    rY    = pAtlas->mnY;
+    rPage = GLuint(pAtlas->m_Pages.size() - 1);
+
+    pAtlas->mnX     += rWidth;
+    pAtlas->mnShelf  = std::max(pAtlas->mnShelf, rHeight);
+
+    return true;
+} // GLUGlyphAtlasAllocate
+
+// Mark where the shelves stand before a batch is packed
+static GLU::GlyphShelf GLUGlyphAtlasGetShelf(const GLU::GlyphAtlas * const pAtlas)
+{
+    GLU::GlyphShelf shelf;
+
+    shelf.mnX     = pAtlas->mnX;
+    shelf.mnY     = pAtlas->mnY;
+    shelf.mnShelf = pAtlas->mnShelf;
+    shelf.mnPages = pAtlas->m_Pages.size();
+
+    return shelf;
+} // GLUGlyphAtlasGetShelf
+
+// Give the space packed since the mark back to the atlas, deleting the
+// pages started meanwhile.  None of its glyphs were added to their faces.
+static void GLUGlyphAtlasSetShelf(const GLU::GlyphShelf& rShelf,
+                                  GLU::GlyphAtlas *pAtlas)
+{
+    if(pAtlas->m_Pages.size() > rShelf.mnPages)
+    {
+        glDeleteTextures(GLsizei(pAtlas->m_Pages.size() - rShelf.mnPages),
+                         pAtlas->m_Pages.data() + rShelf.mnPages);
+
+        pAtlas->m_Pages.resize(rShelf.mnPages);
+    } // if
+
+    pAtlas->mnX     = rShelf.mnX;
+    pAtlas->mnY     = rShelf.mnY;
+    pAtlas->mnShelf = rShelf.mnShelf;
+} // GLUGlyphAtlasSetShelf
+
+// Empty a full atlas, deleting its pages and the glyphs of every face, so
+// the glyphs in use are packed again as they are laid out.  Faces are kept
+// for the layouts pointing at them.  Quads from before the reset sample
+// stale texels, and are laid out again by their consumers, who compare the
+// generation of the atlas with the one they were laid out at.
+static void GLUGlyphAtlasReset(GLU::GlyphAtlas *pAtlas)
+{
+    NSLog(@">> WARNING: The glyph atlas is full, with %u pages, rasterizing its glyphs again!", GLU::kGlyphAtlasPageMax);
+
+    {
+        std::lock_guard<std::mutex> lock(pAtlas->m_Mutex);
+
+        for(auto& rFace : pAtlas->m_Faces)
+        {
+            rFace.second.m_Glyphs.clear();
+        } // for
+
+        pAtlas->mnGeneration++;
+    }
+
+    if(!pAtlas->m_Pages.empty())
+    {
+        glDeleteTextures(GLsizei(pAtlas->m_Pages.size()), pAtlas->m_Pages.data());
+
+        pAtlas->m_Pages.clear();
+    } // if
+
+    pAtlas->mnX     = 0;
+    pAtlas->mnY     = 0;
+    pAtlas->mnShelf = 0;
+    pAtlas->mbFull  = false;
+} // GLUGlyphAtlasReset
+
+#pragma mark -
+#pragma mark Private - Utilities - Distance Fields
+
+// Squared distances along a row or a column of a grid, in place, from the
+// lower envelope of the parabolas rooted at each sample (Felzenszwalb and
+// Huttenlocher).  The scratch arrays hold a sample more than the line.
+static void GLUGlyphAtlasTransformLine(GLfloat *pGrid,
+                                       const GLuint& rOffset,
+                                       const GLuint& rStride,
+                                       const GLuint& rLength,
+                                       GLfloat *pF,
+                                       GLint *pV,
+                                       GLfloat *pZ)
+{
+    GLint k = 0;
+
+    pV[0] = 0;
+    pZ[0] = -GLU::kGlyphAtlasFar;
+    pZ[1] =  GLU::kGlyphAtlasFar;
+    pF[0] = pGrid[rOffset];
+
+    for(GLint q = 1; q < GLint(rLength); ++q)
+    {
+        pF[q] = pGrid[rOffset + q * rStride];
+
+        GLfloat s = 0.0f;
+
+        do
+        {
+            const GLint r = pV[k];
+
+            s = 0.5f * (pF[q] - pF[r] + GLfloat(q * q - r * r)) / GLfloat(q - r);
+        }
+        while((s <= pZ[k]) && (--k > -1));
+
+        ++k;
+
+        pV[k]     = q;
+        pZ[k]     = s;
+        pZ[k + 1] = GLU::kGlyphAtlasFar;
+    } // for
+
+    k = 0;
+
+    for(GLint q = 0; q < GLint(rLength); ++q)
+    {
+        while(pZ[k + 1] < GLfloat(q))
+        {
+            ++k;
+        } // while
+
+        const GLfloat d = GLfloat(q - pV[k]);
+
+        pGrid[rOffset + q * rStride] = pF[pV[k]] + d * d;
+    } // for
+} // GLUGlyphAtlasTransformLine
+
+// Squared distances of a grid, transforming its columns then its rows
+static void GLUGlyphAtlasTransform(GLfloat *pGrid,
+                                   const GLuint& rWidth,
+                                   const GLuint& rHeight,
+                                   GLfloat *pF,
+                                   GLint *pV,
+                                   GLfloat *pZ)
+{
+    for(GLuint x = 0; x < rWidth; ++x)
+    {
+        GLUGlyphAtlasTransformLine(pGrid, x, rWidth, rHeight, pF, pV, pZ);
+    } // for
+
+    for(GLuint y = 0; y < rHeight; ++y)
+    {
+        GLUGlyphAtlasTransformLine(pGrid, y * rWidth, 1, rWidth, pF, pV, pZ);
+    } // for
+} // GLUGlyphAtlasTransform
+
+// Rasterize a glyph, and get its signed distance field from the squared
+// distances to its outside and to its inside.  Anti-aliased texels are
+// seeded with their sub-texel distance to the outline, estimated from
+// their coverage.  Called concurrently, for a glyph each.
+static void GLUGlyphAtlasCreateField(void *pFields,
+                                     size_t nIndex)
+{
+    GLU::GlyphField& rField = static_cast<GLU::GlyphField *>(pFields)[nIndex];
+
+    CTFontRef pFont = rField.mpFace->mpFont;
+
+    CGRect rect = CGRectZero;
+
+    CTFontGetBoundingRectsForGlyphs(pFont, kCTFontOrientationHorizontal, &rField.mnGlyph, &rect, 1);
+
+    rField.m_Glyph.mbEmpty = CGRectIsEmpty(rect);
+
+    if(rField.m_Glyph.mbEmpty)
+    {
+        return;
+    } // if
+
+    // Snap the bounds to whole pixels
+    const CGFloat nLeft   = std::floor(CGRectGetMinX(rect));
+    const CGFloat nBottom = std::floor(CGRectGetMinY(rect));
+    const CGFloat nRight  = std::ceil(CGRectGetMaxX(rect));
+    const CGFloat nTop    = std::ceil(CGRectGetMaxY(rect));
+
+    const GLuint nWidth  = GLuint(nRight - nLeft) + 2 * GLU::kGlyphAtlasSpread;
+    const GLuint nHeight = GLuint(nTop - nBottom) + 2 * GLU::kGlyphAtlasSpread;
+    const GLuint nCount  = nWidth * nHeight;
+    const GLuint nLength = std::max(nWidth, nHeight);
+
+    try
+    {
+        rField.m_Field.assign(nCount, 0);
+
+        CGContextRef pContext = CGBitmapContextCreate(rField.m_Field.data(),
+                                                      nWidth,
+                                                      nHeight,
+                                                      8,
+                                                      nWidth,
+                                                      nullptr,
+                                                      kCGImageAlphaOnly);
+
+        if(pContext == nullptr)
+        {
+            rField.mbFailed = true;
+
+            return;
+        } // if
+
+        // Draw the glyph with its bounds inside the spread
+        const CGPoint origin = CGPointMake(CGFloat(GLU::kGlyphAtlasSpread) - nLeft,
+                                           CGFloat(GLU::kGlyphAtlasSpread) - nBottom);
+
+        CGContextSetGrayFillColor(pContext, 1.0f, 1.0f);
+
+        CTFontDrawGlyphs(pFont, &rField.mnGlyph, &origin, 1, pContext);
+
+        CGContextFlush(pContext);
+        CGContextRelease(pContext);
+
+        std::vector<GLfloat> outside(nCount);
+        std::vector<GLfloat> inside(nCount);
+
+        for(GLuint i = 0; i < nCount; ++i)
+        {
+            const GLfloat a = GLfloat(rField.m_Field[i]) / 255.0f;
+
+            if(a >= 1.0f)
+            {
+                outside[i] = 0.0f;
+                inside[i]  = GLU::kGlyphAtlasFar;
+            } // if
+            else if(a <= 0.0f)
+            {
+                outside[i] = GLU::kGlyphAtlasFar;
+                inside[i]  = 0.0f;
+            } // else if
+            else
+            {
+                const GLfloat dOut = std::max(0.5f - a, 0.0f);
+                const GLfloat dIn  = std::max(a - 0.5f, 0.0f);
+
+                outside[i] = dOut * dOut;
+                inside[i]  = dIn * dIn;
+            } // else
+        } // for
+
+        std::vector<GLfloat> f(nLength);
+        std::vector<GLint>   v(nLength);
+        std::vector<GLfloat> z(nLength + 1);
+
+        GLUGlyphAtlasTransform(outside.data(), nWidth, nHeight, f.data(), v.data(), z.data());
+        GLUGlyphAtlasTransform(inside.data(), nWidth, nHeight, f.data(), v.data(), z.data());
+
+        // Map the spread either side of the outline to [0, 1], inside up
+        const GLfloat nScale = 0.5f / GLfloat(GLU::kGlyphAtlasSpread);
+
+        for(GLuint i = 0; i < nCount; ++i)
+        {
+            const GLfloat d = std::sqrt(outside[i]) - std::sqrt(inside[i]);
+            const GLfloat e = std::min(std::max(0.5f - nScale * d, 0.0f), 1.0f);
+
+            rField.m_Field[i] = GLubyte(std::lround(255.0f * e));
+        } // for
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        rField.mbFailed = true;
+
+        return;
+    } // catch
+
+    rField.mnWidth  = nWidth;
+    rField.mnHeight = nHeight;
+
+    rField.m_Glyph.m_Bounds[0] = GLfloat(nLeft   - CGFloat(GLU::kGlyphAtlasSpread));
+    rField.m_Glyph.m_Bounds[1] = GLfloat(nBottom - CGFloat(GLU::kGlyphAtlasSpread));
+    rField.m_Glyph.m_Bounds[2] = GLfloat(nWidth);
+    rField.m_Glyph.m_Bounds[3] = GLfloat(nHeight);
+} // GLUGlyphAtlasCreateField
+
+#pragma mark -
+#pragma mark Private - Utilities - Glyphs
+
+// Generate the distance fields of the new glyphs concurrently.  Only reads
+// the fonts of their faces, so a layout may call it on any thread.
+static void GLUGlyphAtlasCreateFields(std::vector<GLU::GlyphField>& rFields)
+{
+    if(!rFields.empty())
+    {
+        dispatch_apply_f(rFields.size(),
+                         dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                         rFields.data(),
+                         GLUGlyphAtlasCreateField);
+    } // if
+} // GLUGlyphAtlasCreateFields
+
+// Pack the distance field of a new glyph into the atlas.  Bitmap contexts
+// store their top row first, so the field is uploaded upside down, and its
+// texture coordinates flip it back.
+static bool GLUGlyphAtlasPack(GLU::GlyphField& rField,
+                              GLsizeiptr& rSize,
+                              GLU::GlyphAtlas *pAtlas)
+{
+    if(rField.m_Glyph.mbEmpty)
+    {
+        return true;
+    } // if
+
+    GLuint nPage = 0;
+
+    if(!GLUGlyphAtlasAllocate(rField.mnWidth, rField.mnHeight, rField.mnX, rField.mnY, nPage, pAtlas))
+    {
+        return false;
+    } // if
+
+    const GLfloat nScale = 1.0f / GLfloat(GLU::kGlyphAtlasPageSize);
+
+    rField.m_Glyph.m_TexCoords[0] = nScale * GLfloat(rField.mnX);
+    rField.m_Glyph.m_TexCoords[1] = nScale * GLfloat(rField.mnY + rField.mnHeight);
+    rField.m_Glyph.m_TexCoords[2] = nScale * GLfloat(rField.mnX + rField.mnWidth);
+    rField.m_Glyph.m_TexCoords[3] = nScale * GLfloat(rField.mnY);
+
+    rField.m_Glyph.mnPage = nPage;
+
+    // Fields are tightly packed in the pixel buffer
+    rField.mnOffset = rSize;
+
+    rSize += GLsizeiptr(rField.mnWidth) * GLsizeiptr(rField.mnHeight);
+
+    return true;
+} // GLUGlyphAtlasPack
+
+// Copy the packed fields into the pixel buffer, orphaning its previous
+// storage rather than waiting on uploads still reading it, and upload them
+// into their pages from the buffer
+static bool GLUGlyphAtlasUpload(const std::vector<GLU::GlyphField>& rFields,
+                                const GLsizeiptr& rSize,
+                                GLU::GlyphAtlas *pAtlas)
+{
+    if(!pAtlas->mnPBO)
+    {
+        glGenBuffers(1, &pAtlas->mnPBO);
+
+        if(!pAtlas->mnPBO)
+        {
+            NSLog(@">> ERROR: Failed creating the glyph atlas pixel buffer!");
+
+            return false;
+        } // if
+    } // if
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pAtlas->mnPBO);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, rSize, nullptr, GL_STREAM_DRAW);
+
+    GLubyte *pPixels = static_cast<GLubyte *>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER,
+                                                               0,
+                                                               rSize,
+                                                               GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+
+    bool bSuccess = pPixels != nullptr;
+
+    if(bSuccess)
+    {
+        for(const GLU::GlyphField& rField : rFields)
+        {
+            if(rField.mbUpload && !rField.m_Glyph.mbEmpty)
+            {
+                std::copy(rField.m_Field.begin(), rField.m_Field.end(), pPixels + rField.mnOffset);
+            } // if
+        } // for
+
+        // The contents are undefined if the buffer was lost while mapped
+        bSuccess = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+    } // if
+
+    if(bSuccess)
+    {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        for(const GLU::GlyphField& rField : rFields)
+        {
+            if(rField.mbUpload && !rField.m_Glyph.mbEmpty)
+            {
+                glBindTexture(GL_TEXTURE_2D, pAtlas->m_Pages[rField.m_Glyph.mnPage]);
+
+                glTexSubImage2D(GL_TEXTURE_2D,
+                                0,
+                                rField.mnX,
+                                rField.mnY,
+                                rField.mnWidth,
+                                rField.mnHeight,
+                                GL_RED,
+                                GL_UNSIGNED_BYTE,
+                                reinterpret_cast<const GLvoid *>(rField.mnOffset));
+            } // if
+        } // for
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+    } // if
+    else
+    {
+        NSLog(@">> ERROR: Failed mapping the glyph atlas pixel buffer!");
+    } // else
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    return bSuccess;
+} // GLUGlyphAtlasUpload
+
+// Pack the fields of the glyphs new to the atlas, upload them, and add the
+// glyphs to their faces.  Glyphs added by another commit since the fields
+// were generated are skipped.  Every glyph is placed before the upload, as
+// new pages are cleared from client memory with no pixel buffer bound.  A
+// batch is added whole or not at all, its space given back on failure.
+static bool GLUGlyphAtlasAddGlyphs(std::vector<GLU::GlyphField>& rFields,
+                                   GLU::GlyphAtlas *pAtlas)
+{
+    const GLU::GlyphShelf shelf = GLUGlyphAtlasGetShelf(pAtlas);
+
+    GLsizeiptr nSize = 0;
+
+    pAtlas->mbFull = false;
+
+    bool bSuccess = true;
+
+    for(GLU::GlyphField& rField : rFields)
+    {
+        if(rField.mbFailed)
+        {
+            NSLog(@">> ERROR: Failed generating the distance field of glyph %u!", GLuint(rField.mnGlyph));
+
+            bSuccess = false;
+
+            break;
+        } // if
+
+        rField.mbUpload = rField.mpFace->m_Glyphs.count(rField.mnGlyph) == 0;
+
+        if(rField.mbUpload && !GLUGlyphAtlasPack(rField, nSize, pAtlas))
+        {
+            bSuccess = false;
+
+            break;
+        } // if
+    } // for
+
+    if(bSuccess && nSize)
+    {
+        bSuccess = GLUGlyphAtlasUpload(rFields, nSize, pAtlas);
+    } // if
+
+    if(!bSuccess)
+    {
+        GLUGlyphAtlasSetShelf(shelf, pAtlas);
+
+        return false;
+    } // if
+
+    std::lock_guard<std::mutex> lock(pAtlas->m_Mutex);
+
+    for(const GLU::GlyphField& rField : rFields)
+    {
+        if(rField.mbUpload)
+        {
+            rField.mpFace->m_Glyphs.emplace(rField.mnGlyph, rField.m_Glyph);
+        } // if
+    } // for
+
+    return true;
+} // GLUGlyphAtlasAddGlyphs
+
+#pragma mark -
+#pragma mark Private - Utilities - Faces
+
+// Find the face of a font at the field size of its footprint, creating it
+// the first time it is used
+static GLU::GlyphFace *GLUGlyphAtlasFindFace(CTFontRef pFont,
+                                             const CGFloat& rScale,
+                                             GLU::GlyphAtlas *pAtlas)
+{
+    const GLuint nSize = GLU::GlyphAtlasGetFieldSize(CTFontGetSize(pFont) * rScale);
+
+    GLchar name[256] = {0};
+
+    CFStringRef pName = CTFontCopyPostScriptName(pFont);
+
+    if(pName != nullptr)
+    {
+        CFStringGetCString(pName, name, sizeof(name), kCFStringEncodingUTF8);
+
+        CFRelease(pName);
+    } // if
+
+    const GLU::String key = GLU::String(name) + "@" + std::to_string(nSize);
+
+    auto pIter = pAtlas->m_Faces.find(key);
+
+    if(pIter != pAtlas->m_Faces.end())
+    {
+        return &pIter->second;
+    } // if
+
+    CTFontRef pFieldFont = CTFontCreateCopyWithAttributes(pFont, CGFloat(nSize), nullptr, nullptr);
+
+    if(pFieldFont == nullptr)
+    {
+        return nullptr;
+    } // if
+
+    GLU::GlyphFace& rFace = pAtlas->m_Faces[key];
+
+    rFace.mpFont = pFieldFont;
+    rFace.mnSize = CGFloat(nSize);
+
+    return &rFace;
+} // GLUGlyphAtlasFindFace
+
+#pragma mark -
+#pragma mark Private - Utilities - Layout
+
+// Get the components of a foreground color, in gray or RGB
+static void GLUGlyphAtlasGetColor(CGColorRef pColor,
+                                  GLfloat * const pComponents)
+{
+    if(pColor != nullptr)
+    {
+        const CGFloat *pSrc = CGColorGetComponents(pColor);
+
+        switch(CGColorGetNumberOfComponents(pColor))
+        {
+            case 2:
+                pComponents[0] = GLfloat(pSrc[0]);
+                pComponents[1] = GLfloat(pSrc[0]);
+                pComponents[2] = GLfloat(pSrc[0]);
+                pComponents[3] = GLfloat(pSrc[1]);
+                break;
+
+            case 4:
+                pComponents[0] = GLfloat(pSrc[0]);
+                pComponents[1] = GLfloat(pSrc[1]);
+                pComponents[2] = GLfloat(pSrc[2]);
+                pComponents[3] = GLfloat(pSrc[3]);
+                break;
+
+            default:
+                break;
+        } // switch
+    } // if
+} // GLUGlyphAtlasGetColor
+
+// Queue a glyph new to its face, once, under the mutex
+static void GLUGlyphAtlasQueueGlyph(const CGGlyph& rGlyph,
+                                    GLU::GlyphFace *pFace,
+                                    std::vector<GLU::GlyphField>& rFields)
+{
+    // Rasterized, or already queued by a previous run
+    bool bQueued = pFace->m_Glyphs.count(rGlyph) != 0;
+
+    for(size_t i = 0; !bQueued && (i < rFields.size()); ++i)
+    {
+        bQueued = (rFields[i].mpFace == pFace) && (rFields[i].mnGlyph == rGlyph);
+    } // for
+
+    if(!bQueued)
+    {
+        GLU::GlyphField field;
+
+        field.mpFace   = pFace;
+        field.mnGlyph  = rGlyph;
+        field.mnWidth  = 0;
+        field.mnHeight = 0;
+        field.mnX      = 0;
+        field.mnY      = 0;
+        field.mnOffset = 0;
+        field.mbFailed = false;
+        field.mbUpload = false;
+        field.m_Glyph  = {{0.0f}, {0.0f}, 0, true};
+
+        rFields.push_back(std::move(field));
+    } // if
+} // GLUGlyphAtlasQueueGlyph
+
+// Get the glyphs of a run, and queue the glyphs new to its face, once each
+static bool GLUGlyphAtlasGetRun(CTRunRef pRun,
+                                const CGPoint& rOrigin,
+                                std::vector<GLU::GlyphRun>& rRuns,
+                                std::vector<GLU::GlyphField>& rFields,
+                                const CGFloat& rScale,
+                                GLU::GlyphAtlas *pAtlas)
+{
+    CFDictionaryRef pAttributes = CTRunGetAttributes(pRun);
+
+    CTFontRef pFont = CTFontRef(CFDictionaryGetValue(pAttributes, kCTFontAttributeName));
+
+    if(pFont == nullptr)
+    {
+        return true;
+    } // if
+
+    GLU::GlyphFace *pFace = GLUGlyphAtlasFindFace(pFont, rScale, pAtlas);
+
+    if(pFace == nullptr)
+    {
+        return false;
+    } // if
+
+    const CFIndex nCount = CTRunGetGlyphCount(pRun);
+
+    rRuns.emplace_back();
+
+    GLU::GlyphRun& rRun = rRuns.back();
+
+    rRun.mpFace   = pFace;
+    rRun.m_Origin = rOrigin;
+
+    // Glyphs of the field scaled to the font size
+    rRun.mnScale = CTFontGetSize(pFont) / pFace->mnSize;
+
+    std::fill(rRun.m_Color, rRun.m_Color + 4, 1.0f);
+
+    GLUGlyphAtlasGetColor(CGColorRef(CFDictionaryGetValue(pAttributes, kCTForegroundColorAttributeName)), rRun.m_Color);
+
+    rRun.m_Glyphs.resize(nCount);
+    rRun.m_Positions.resize(nCount);
+
+    CTRunGetGlyphs(pRun, CFRangeMake(0, 0), rRun.m_Glyphs.data());
+    CTRunGetPositions(pRun, CFRangeMake(0, 0), rRun.m_Positions.data());
+
+    for(const CGGlyph& rGlyph : rRun.m_Glyphs)
+    {
+        GLUGlyphAtlasQueueGlyph(rGlyph, pFace, rFields);
+    } // for
+
+    return true;
+} // GLUGlyphAtlasGetRun
+
+// Queue the glyphs of a layout that a reset of the atlas cleared since it
+// was laid out, and generate their fields on the committing thread
+static void GLUGlyphAtlasQueueCleared(GLU::GlyphLayout *pLayout,
+                                      GLU::GlyphAtlas *pAtlas)
+{
+    const size_t nFields = pLayout->m_Fields.size();
+
+    {
+        std::lock_guard<std::mutex> lock(pAtlas->m_Mutex);
+
+        for(const GLU::GlyphRun& rRun : pLayout->m_Runs)
+        {
+            for(const CGGlyph& rGlyph : rRun.m_Glyphs)
+            {
+                GLUGlyphAtlasQueueGlyph(rGlyph, rRun.mpFace, pLayout->m_Fields);
+            } // for
+        } // for
+
+        pLayout->mnGeneration = pAtlas->mnGeneration;
+    }
+
+    if(pLayout->m_Fields.size() > nFields)
+    {
+        std::vector<GLU::GlyphField> fields(std::make_move_iterator(pLayout->m_Fields.begin() + nFields),
+                                            std::make_move_iterator(pLayout->m_Fields.end()));
+
+        GLUGlyphAtlasCreateFields(fields);
+
+        std::move(fields.begin(), fields.end(), pLayout->m_Fields.begin() + nFields);
+    } // if
+} // GLUGlyphAtlasQueueCleared
+
+// Add the new glyphs of a layout to the atlas.  When the atlas is full it
+// is reset, and the glyphs of the layout are added again to the empty one.
+static bool GLUGlyphAtlasAddLayout(GLU::GlyphLayout *pLayout,
+                                   GLU::GlyphAtlas *pAtlas)
+{
+    if(pLayout->mnGeneration != pAtlas->mnGeneration)
+    {
+        GLUGlyphAtlasQueueCleared(pLayout, pAtlas);
+    } // if
+
+    if(GLUGlyphAtlasAddGlyphs(pLayout->m_Fields, pAtlas))
+    {
+        return true;
+    } // if
+
+    if(!pAtlas->mbFull)
+    {
+        return false;
+    } // if
+
+    GLUGlyphAtlasReset(pAtlas);
+
+    GLUGlyphAtlasQueueCleared(pLayout, pAtlas);
+
+    if(!GLUGlyphAtlasAddGlyphs(pLayout->m_Fields, pAtlas))
+    {
+        NSLog(@">> ERROR: The glyphs of a string do not fit in the %u pages of the glyph atlas!", GLU::kGlyphAtlasPageMax);
+
+        return false;
+    } // if
+
+    return true;
+} // GLUGlyphAtlasAddLayout
+
+// Append the glyph quads of a run
+static void GLUGlyphAtlasLayoutRun(const GLU::GlyphRun& rRun,
+                                   GLU::GlyphQuads& rQuads)
+{
+    const CGFloat nScale = rRun.mnScale;
+
+    for(size_t i = 0; i < rRun.m_Glyphs.size(); ++i)
+    {
+        const GLU::Glyph& rGlyph = rRun.mpFace->m_Glyphs.at(rRun.m_Glyphs[i]);
+
+        if(!rGlyph.mbEmpty)
+        {
+            GLU::GlyphQuad quad;
+
+            quad.m_Bounds = CGRectMake(rRun.m_Origin.x + rRun.m_Positions[i].x + nScale * rGlyph.m_Bounds[0],
+                                       rRun.m_Origin.y + rRun.m_Positions[i].y + nScale * rGlyph.m_Bounds[1],
+                                       nScale * rGlyph.m_Bounds[2],
+                                       nScale * rGlyph.m_Bounds[3]);
+
+            std::copy(rGlyph.m_TexCoords, rGlyph.m_TexCoords + 4, quad.m_TexCoords);
+            std::copy(rRun.m_Color, rRun.m_Color + 4, quad.m_Color);
+
+            quad.mnPage = rGlyph.mnPage;
+
+            rQuads.push_back(quad);
+        } // if
+    } // for
+} // GLUGlyphAtlasLayoutRun
+
+// Get the runs of every line of a frame, and queue the glyphs new to the
+// atlas, under its mutex as other threads may be laying out strings
+static bool GLUGlyphAtlasGetFrame(CTFrameRef pFrame,
+                                  GLU::GlyphLayout *pLayout,
+                                  const CGFloat& rScale,
+                                  GLU::GlyphAtlas *pAtlas)
+{
+    CFArrayRef pLines = CTFrameGetLines(pFrame);
+
+    const CFIndex nLines = CFArrayGetCount(pLines);
+
+    std::vector<CGPoint> origins(nLines);
+
+    CTFrameGetLineOrigins(pFrame, CFRangeMake(0, 0), origins.data());
+
+    std::lock_guard<std::mutex> lock(pAtlas->m_Mutex);
+
+    pLayout->mnGeneration = pAtlas->mnGeneration;
+
+    for(CFIndex i = 0; i < nLines; ++i)
+    {
+        CFArrayRef pRuns = CTLineGetGlyphRuns(CTLineRef(CFArrayGetValueAtIndex(pLines, i)));
+
+        const CFIndex nRuns = CFArrayGetCount(pRuns);
+
+        for(CFIndex j = 0; j < nRuns; ++j)
+        {
+            if(!GLUGlyphAtlasGetRun(CTRunRef(CFArrayGetValueAtIndex(pRuns, j)),
+                                    origins[i],
+                                    pLayout->m_Runs,
+                                    pLayout->m_Fields,
+                                    rScale,
+                                    pAtlas))
+            {
+                return false;
+            } // if
+        } // for
+    } // for
+
+    return true;
+} // GLUGlyphAtlasGetFrame
+
+// Create an attributed string from a CF string, font, justification, and
+// font size, leaving the color to the vertices
+static CFMutableAttributedStringRef GLUGlyphAtlasCreateAttributedString(CFStringRef pString,
+                                                                        CFStringRef pFontName,
+                                                                        const CGFloat& rFontSize,
+                                                                        const CTTextAlignment nAlignment)
+{
+    CFMutableAttributedStringRef pAttrString = nullptr;
+
+    // For single spacing between the lines
+    const CGFloat nLineHeightMultiple = 1.0f;
+
+    CTParagraphStyleSetting settings[2] =
+    {
+        {kCTParagraphStyleSpecifierAlignment, sizeof(CTTextAlignment), &nAlignment},
+        {kCTParagraphStyleSpecifierLineHeightMultiple, sizeof(CGFloat), &nLineHeightMultiple}
+    };
+
+    CTParagraphStyleRef pStyle = CTParagraphStyleCreate(settings, 2);
+
+    if(pStyle != nullptr)
+    {
+        CTFontRef pFont = CTFontCreateWithName(pFontName ? pFontName : CFSTR("Helvetica"), rFontSize, nullptr);
+
+        if(pFont != nullptr)
+        {
+            pAttrString = CFAttributedStringCreateMutable(kCFAllocatorDefault, 0);
+
+            if(pAttrString != nullptr)
+            {
+                CFAttributedStringReplaceString(pAttrString, CFRangeMake(0, 0), pString);
+
+                const CFRange range = CFRangeMake(0, CFAttributedStringGetLength(pAttrString));
+
+                CFAttributedStringSetAttribute(pAttrString, range, kCTParagraphStyleAttributeName, pStyle);
+                CFAttributedStringSetAttribute(pAttrString, range, kCTFontAttributeName, pFont);
+            } // if
+
+            CFRelease(pFont);
+        } // if
+
+        CFRelease(pStyle);
+    } // if
+
+    return pAttrString;
+} // GLUGlyphAtlasCreateAttributedString
+
+#pragma mark -
+#pragma mark Public - Constructor
+
+// Acquire the shared glyph atlas of the share group of the current context
+GLU::GlyphAtlasRef GLU::GlyphAtlasAcquire()
+{
+    CGLShareGroupObj pShareGroup = CGLGetShareGroup(CGLGetCurrentContext());
+
+    for(GLU::GlyphAtlas *pAtlas : GLU::gGlyphAtlases)
+    {
+        if(pAtlas->mpShareGroup == pShareGroup)
+        {
+            pAtlas->mnRefs++;
+
+            return pAtlas;
+        } // if
+    } // for
+
+    GLU::GlyphAtlasRef pAtlas = nullptr;
+
+    try
+    {
+        pAtlas = new GLU::GlyphAtlas;
+
+        pAtlas->mpShareGroup = pShareGroup;
+        pAtlas->mnRefs       = 1;
+        pAtlas->mnX          = 0;
+        pAtlas->mnY          = 0;
+        pAtlas->mnShelf      = 0;
+        pAtlas->mnPBO        = 0;
+        pAtlas->mnGeneration = 0;
+        pAtlas->mbFull       = false;
+
+        GLU::gGlyphAtlases.push_back(pAtlas);
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for the glyph atlas: \"%s\"", ba.what());
+
+        delete pAtlas;
+
+        return nullptr;
+    } // catch
+
+    return pAtlas;
+} // GLUGlyphAtlasAcquire
+
+#pragma mark -
+#pragma mark Public - Destructor
+
+// Release the shared glyph atlas, with a context of its share group current
+void GLU::GlyphAtlasRelease(GLU::GlyphAtlasRef pAtlas)
+{
+    if((pAtlas != nullptr) && !--pAtlas->mnRefs)
+    {
+        for(auto& rFace : pAtlas->m_Faces)
+        {
+            CFRelease(rFace.second.mpFont);
+        } // for
+
+        if(!pAtlas->m_Pages.empty())
+        {
+            glDeleteTextures(GLsizei(pAtlas->m_Pages.size()), pAtlas->m_Pages.data());
+        } // if
+
+        if(pAtlas->mnPBO)
+        {
+            glDeleteBuffers(1, &pAtlas->mnPBO);
+        } // if
+
+        GLU::gGlyphAtlases.erase(std::remove(GLU::gGlyphAtlases.begin(), GLU::gGlyphAtlases.end(), pAtlas),
+                                 GLU::gGlyphAtlases.end());
+
+        delete pAtlas;
+    } // if
+} // GLUGlyphAtlasRelease
+
+#pragma mark -
+#pragma mark Public - Layout
+
+// Lay out an attributed string, and generate the fields of its new glyphs
+GLU::GlyphLayoutRef GLU::GlyphAtlasLayoutCreate(CFAttributedStringRef pAttrString,
+                                                const CGFloat& rScale,
+                                                GLU::GlyphAtlasRef pAtlas)
+{
+    GLU::GlyphLayoutRef pLayout = nullptr;
+
+    if((pAttrString != nullptr) && (pAtlas != nullptr))
+    {
+        CTFramesetterRef pFrameSetter = CTFramesetterCreateWithAttributedString(pAttrString);
+
+        if(pFrameSetter != nullptr)
+        {
+            CGMutablePathRef pPath = CGPathCreateMutable();
+
+            if(pPath != nullptr)
+            {
+                try
+                {
+                    pLayout = new GLU::GlyphLayout;
+
+                    CFRange range;
+                    CGSize  constraint = CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX);
+
+                    // Get the CoreText suggested size from our framesetter
+                    pLayout->m_Size = CTFramesetterSuggestFrameSizeWithConstraints(pFrameSetter,
+                                                                                   CFRangeMake(0, CFAttributedStringGetLength(pAttrString)),
+                                                                                   nullptr,
+                                                                                   constraint,
+                                                                                   &range);
+
+                    CGPathAddRect(pPath, nullptr, CGRectMake(0.0f, 0.0f, pLayout->m_Size.width, pLayout->m_Size.height));
+
+                    CTFrameRef pFrame = CTFramesetterCreateFrame(pFrameSetter, range, pPath, nullptr);
+
+                    bool bSuccess = false;
+
+                    if(pFrame != nullptr)
+                    {
+                        bSuccess = GLUGlyphAtlasGetFrame(pFrame, pLayout, rScale, pAtlas);
+
+                        CFRelease(pFrame);
+                    } // if
+
+                    if(bSuccess)
+                    {
+                        GLUGlyphAtlasCreateFields(pLayout->m_Fields);
+                    } // if
+                    else
+                    {
+                        delete pLayout;
+
+                        pLayout = nullptr;
+                    } // else
+                } // try
+                catch(std::bad_alloc& ba)
+                {
+                    NSLog(@">> ERROR: Failed allocating memory for a glyph layout: \"%s\"", ba.what());
+
+                    delete pLayout;
+
+                    pLayout = nullptr;
+                } // catch
+
+                CFRelease(pPath);
+            } // if
+
+            CFRelease(pFrameSetter);
+        } // if
+    } // if
+
+    return pLayout;
+} // GLUGlyphAtlasLayoutCreate
+
+// Lay out a core foundation string, and generate the fields of its new
+// glyphs
+GLU::GlyphLayoutRef GLU::GlyphAtlasLayoutCreate(CFStringRef pString,
+                                                CFStringRef pFontName,
+                                                const CGFloat& rFontSize,
+                                                const CTTextAlignment& rAlignment,
+                                                const CGFloat& rScale,
+                                                GLU::GlyphAtlasRef pAtlas)
+{
+    GLU::GlyphLayoutRef pLayout = nullptr;
+
+    if(pString != nullptr)
+    {
+        CFMutableAttributedStringRef pAttrString = GLUGlyphAtlasCreateAttributedString(pString,
+                                                                                       pFontName,
+                                                                                       rFontSize,
+                                                                                       rAlignment);
+
+        if(pAttrString != nullptr)
+        {
+            pLayout = GLU::GlyphAtlasLayoutCreate(pAttrString, rScale, pAtlas);
+
+            CFRelease(pAttrString);
+        } // if
+    } // if
+
+    return pLayout;
+} // GLUGlyphAtlasLayoutCreate
+
+// Add the new glyphs of a layout to the atlas, and get its glyph quads
+bool GLU::GlyphAtlasLayoutCommit(GLU::GlyphLayoutRef pLayout,
+                                 NSSize& rSize,
+                                 GLU::GlyphQuads& rQuads,
+                                 GLU::GlyphAtlasRef pAtlas)
+{
+    bool bSuccess = false;
+
+    if((pLayout != nullptr) && (pAtlas != nullptr))
+    {
+        try
+        {
+            rQuads.clear();
+
+            bSuccess = GLUGlyphAtlasAddLayout(pLayout, pAtlas);
+
+            if(bSuccess)
+            {
+                for(const GLU::GlyphRun& rRun : pLayout->m_Runs)
+                {
+                    GLUGlyphAtlasLayoutRun(rRun, rQuads);
+                } // for
+
+                rSize = pLayout->m_Size;
+            } // if
+        } // try
+        catch(std::bad_alloc& ba)
+        {
+            NSLog(@">> ERROR: Failed allocating memory for glyph quads: \"%s\"", ba.what());
+
+            bSuccess = false;
+        } // catch
+    } // if
+
+    return bSuccess;
+} // GLUGlyphAtlasLayoutCommit
+
+// Delete a layout
+void GLU::GlyphAtlasLayoutDelete(GLU::GlyphLayoutRef pLayout)
+{
+    delete pLayout;
+} // GLUGlyphAtlasLayoutDelete
+
+// Lay out an attributed string into glyph quads
+bool GLU::GlyphAtlasLayout(CFAttributedStringRef pAttrString,
+                           NSSize& rSize,
+                           GLU::GlyphQuads& rQuads,
+                           const CGFloat& rScale,
+                           GLU::GlyphAtlasRef pAtlas)
+{
+    GLU::GlyphLayoutRef pLayout = GLU::GlyphAtlasLayoutCreate(pAttrString, rScale, pAtlas);
+
+    const bool bSuccess = GLU::GlyphAtlasLayoutCommit(pLayout, rSize, rQuads, pAtlas);
+
+    GLU::GlyphAtlasLayoutDelete(pLayout);
+
+    return bSuccess;
+} // GLUGlyphAtlasLayout
+
+// Lay out a core foundation string into glyph quads
+bool GLU::GlyphAtlasLayout(CFStringRef pString,
+                           CFStringRef pFontName,
+                           const CGFloat& rFontSize,
+                           const CTTextAlignment& rAlignment,
+                           NSSize& rSize,
+                           GLU::GlyphQuads& rQuads,
+                           const CGFloat& rScale,
+                           GLU::GlyphAtlasRef pAtlas)
+{
+    GLU::GlyphLayoutRef pLayout = GLU::GlyphAtlasLayoutCreate(pString, pFontName, rFontSize, rAlignment, rScale, pAtlas);
+
+    const bool bSuccess = GLU::GlyphAtlasLayoutCommit(pLayout, rSize, rQuads, pAtlas);
+
+    GLU::GlyphAtlasLayoutDelete(pLayout);
+
+    return bSuccess;
+} // GLUGlyphAtlasLayout
+
+#pragma mark -
+#pragma mark Public - Accessors
+
+// Get the field size of a footprint, the power of two at or above it
+const GLuint GLU::GlyphAtlasGetFieldSize(const CGFloat& rPixels)
+{
+    if(!(rPixels > 0.0f))
+    {
+        return GLU::kGlyphAtlasFieldSize;
+    } // if
+
+    GLuint nSize = GLU::kGlyphAtlasFieldMin;
+
+    while((nSize < GLU::kGlyphAtlasFieldMax) && (CGFloat(nSize) < rPixels))
+    {
+        nSize <<= 1;
+    } // while
+
+    return nSize;
+} // GLUGlyphAtlasGetFieldSize
+
+// Get the texture id of an atlas page
+const GLuint GLU::GlyphAtlasGetTexture(const GLuint& rPage,
+                                       const GLU::GlyphAtlasRef pAtlas)
+{
+    return ((pAtlas != nullptr) && (rPage < pAtlas->m_Pages.size())) ? pAtlas->m_Pages[rPage] : 0;
+} // GLUGlyphAtlasGetTexture
+
+// Get the number of atlas pages
+const GLuint GLU::GlyphAtlasGetPageCount(const GLU::GlyphAtlasRef pAtlas)
+{
+    return (pAtlas != nullptr) ? GLuint(pAtlas->m_Pages.size()) : 0;
+} // GLUGlyphAtlasGetPageCount
+
+// Get the number of times the atlas was reset
+const GLuint GLU::GlyphAtlasGetGeneration(const GLU::GlyphAtlasRef pAtlas)
+{
+    return (pAtlas != nullptr) ? pAtlas->mnGeneration : 0;
+} // GLUGlyphAtlasGetGeneration
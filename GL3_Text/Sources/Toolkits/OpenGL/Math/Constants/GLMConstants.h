@@ -50,7 +50,7 @@
 #ifndef _OPENGL_MATH_CONSTANTS_H_
 #define _OPENGL_MATH_CONSTANTS_H_
 
-#import <OpenGL/OpenGL.h>
+#import "GLMPlatform.h"
 
 #ifdef __cplusplus
 
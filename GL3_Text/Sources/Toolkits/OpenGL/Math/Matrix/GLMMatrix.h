@@ -0,0 +1,433 @@
+/*
+     File: GLMMatrix.h
+ Abstract:
+ Header-only, constexpr evaluable fixed size vector and matrix templates.
+
+ Mat<N> stores its elements exactly like the column-major GLfloat[N*N]
+ arrays used by glUniformMatrix*fv and the C matrix utilities, so a Mat<4>
+ may be passed anywhere a GLfloat[16] is expected via data().
+
+ Products of matrices are not evaluated eagerly.  An expression such as
+ P * V * M * v is folded into a chain of matrix-vector products
+ P * (V * (M * v)) without materializing P * V or P * V * M, and assigning
+ P * V * M to a Mat<4> evaluates it one column at a time.  Expressions keep
+ references to their matrix operands, so convert them to a Mat<N> rather
+ than holding on to them with auto.
+
+ */
+
+#ifndef _OPENGL_MATH_MATRIX_H_
+#define _OPENGL_MATH_MATRIX_H_
+
+#import "GLMPlatform.h"
+
+#ifdef __cplusplus
+
+#import <cmath>
+#import <cstddef>
+#import <cstring>
+#import <type_traits>
+
+// Whether functions can tell constant evaluation from runtime evaluation,
+// as std::is_constant_evaluated does in C++20
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define GLM_HAS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+#ifndef GLM_HAS_CONSTANT_EVALUATED
+#define GLM_HAS_CONSTANT_EVALUATED 0
+#endif
+
+namespace GLM
+{
+#pragma mark -
+#pragma mark Public - Scalars
+
+    // Square root usable in constant expressions (Newton-Raphson in double
+    // precision).  At runtime it is std::sqrt, where the compiler can tell.
+    // Non-positive values and NaN give 0.
+    constexpr float csqrt(const float& x)
+    {
+        if(!(x > 0.0f))
+        {
+            return 0.0f;
+        } // if
+
+#if GLM_HAS_CONSTANT_EVALUATED
+        if(!__builtin_is_constant_evaluated())
+        {
+            return std::sqrt(x);
+        } // if
+#endif
+
+        double g = (x > 1.0f) ? double(x) : 1.0;
+
+        for(int i = 0; i < 128; ++i)
+        {
+            double n = 0.5 * (g + double(x) / g);
+
+            if(n >= g)
+            {
+                break;
+            } // if
+
+            g = n;
+        } // for
+
+        return float(g);
+    } // csqrt
+
+#pragma mark -
+#pragma mark Public - Vectors
+
+    template <std::size_t N>
+    struct Vec
+    {
+        static constexpr std::size_t size = N;
+
+        GLfloat m[N];
+
+        constexpr       GLfloat& operator[](const std::size_t& i)       { return m[i]; }
+        constexpr const GLfloat& operator[](const std::size_t& i) const { return m[i]; }
+
+        constexpr       GLfloat* data()       { return m; }
+        constexpr const GLfloat* data() const { return m; }
+    }; // Vec
+
+    typedef Vec<2> Vec2;
+    typedef Vec<3> Vec3;
+    typedef Vec<4> Vec4;
+
+    template <std::size_t N>
+    constexpr Vec<N> operator+(const Vec<N>& a, const Vec<N>& b)
+    {
+        Vec<N> r{};
+
+        for(std::size_t i = 0; i < N; ++i)
+        {
+            r[i] = a[i] + b[i];
+        } // for
+
+        return r;
+    } // operator+
+
+    template <std::size_t N>
+    constexpr Vec<N> operator-(const Vec<N>& a, const Vec<N>& b)
+    {
+        Vec<N> r{};
+
+        for(std::size_t i = 0; i < N; ++i)
+        {
+            r[i] = a[i] - b[i];
+        } // for
+
+        return r;
+    } // operator-
+
+    template <std::size_t N>
+    constexpr Vec<N> operator-(const Vec<N>& a)
+    {
+        Vec<N> r{};
+
+        for(std::size_t i = 0; i < N; ++i)
+        {
+            r[i] = -a[i];
+        } // for
+
+        return r;
+    } // operator-
+
+    template <std::size_t N>
+    constexpr Vec<N> operator*(const GLfloat& s, const Vec<N>& a)
+    {
+        Vec<N> r{};
+
+        for(std::size_t i = 0; i < N; ++i)
+        {
+            r[i] = s * a[i];
+        } // for
+
+        return r;
+    } // operator*
+
+    template <std::size_t N>
+    constexpr GLfloat dot(const Vec<N>& a, const Vec<N>& b)
+    {
+        GLfloat r = 0.0f;
+
+        for(std::size_t i = 0; i < N; ++i)
+        {
+            r += a[i] * b[i];
+        } // for
+
+        return r;
+    } // dot
+
+    constexpr Vec3 cross(const Vec3& a, const Vec3& b)
+    {
+        return Vec3{{a[1] * b[2] - a[2] * b[1],
+                     a[2] * b[0] - a[0] * b[2],
+                     a[0] * b[1] - a[1] * b[0]}};
+    } // cross
+
+    template <std::size_t N>
+    constexpr GLfloat length(const Vec<N>& a)
+    {
+        return csqrt(dot(a, a));
+    } // length
+
+    template <std::size_t N>
+    constexpr Vec<N> normalize(const Vec<N>& a)
+    {
+        GLfloat l = length(a);
+
+        return (l > 0.0f) ? (1.0f / l) * a : a;
+    } // normalize
+
+#pragma mark -
+#pragma mark Public - Matrices
+
+    template <std::size_t N>
+    struct Mat
+    {
+        static constexpr std::size_t size = N;
+
+        // Column-major, element (row, col) lives at m[col * N + row]
+        GLfloat m[N * N];
+
+        constexpr       GLfloat& operator()(const std::size_t& row, const std::size_t& col)       { return m[col * N + row]; }
+        constexpr const GLfloat& operator()(const std::size_t& row, const std::size_t& col) const { return m[col * N + row]; }
+
+        constexpr       GLfloat* data()       { return m; }
+        constexpr const GLfloat* data() const { return m; }
+
+        static constexpr Mat identity()
+        {
+            Mat r{};
+
+            for(std::size_t i = 0; i < N; ++i)
+            {
+                r(i, i) = 1.0f;
+            } // for
+
+            return r;
+        } // identity
+
+        static Mat load(const GLfloat * const pSrc)
+        {
+            Mat r;
+
+            std::memcpy(r.m, pSrc, sizeof(r.m));
+
+            return r;
+        } // load
+
+        constexpr Vec<N> column(const std::size_t& col) const
+        {
+            Vec<N> r{};
+
+            for(std::size_t i = 0; i < N; ++i)
+            {
+                r[i] = m[col * N + i];
+            } // for
+
+            return r;
+        } // column
+
+        // M * v
+        constexpr Vec<N> apply(const Vec<N>& v) const
+        {
+            Vec<N> r{};
+
+            for(std::size_t j = 0; j < N; ++j)
+            {
+                for(std::size_t i = 0; i < N; ++i)
+                {
+                    r[i] += m[j * N + i] * v[j];
+                } // for
+            } // for
+
+            return r;
+        } // apply
+    }; // Mat
+
+    typedef Mat<2> Mat2;
+    typedef Mat<3> Mat3;
+    typedef Mat<4> Mat4;
+
+    static_assert(sizeof(Mat4) == sizeof(GLfloat[16]), "Mat4 must be layout compatible with GLfloat[16]");
+    static_assert(sizeof(Mat3) == sizeof(GLfloat[9]),  "Mat3 must be layout compatible with GLfloat[9]");
+    static_assert(sizeof(Vec4) == sizeof(GLfloat[4]),  "Vec4 must be layout compatible with GLfloat[4]");
+    static_assert(std::is_standard_layout<Mat4>::value && std::is_trivially_copyable<Mat4>::value,
+                  "Mat4 must be trivially copyable");
+
+    // Reinterprets a matrix as another type of identical size and layout,
+    // e.g. simd::float4x4.
+    template <typename T, std::size_t N>
+    T cast(const Mat<N>& M)
+    {
+        static_assert(sizeof(T) == sizeof(Mat<N>), "Cast requires types of identical size");
+
+        T r;
+
+        std::memcpy(&r, M.m, sizeof(T));
+
+        return r;
+    } // cast
+
+#pragma mark -
+#pragma mark Public - Expressions
+
+    template <typename L, typename R> struct MatProduct;
+
+    template <typename T> struct IsMatExpr                         : std::false_type {};
+    template <std::size_t N> struct IsMatExpr<Mat<N>>              : std::true_type  {};
+    template <typename L, typename R> struct IsMatExpr<MatProduct<L, R>> : std::true_type {};
+
+    // Matrices are held by reference, nested expressions by value
+    template <typename T> struct MatOperand                { typedef T type; };
+    template <std::size_t N> struct MatOperand<Mat<N>>     { typedef const Mat<N>& type; };
+
+    template <typename L, typename R>
+    struct MatProduct
+    {
+        static_assert(L::size == R::size, "Matrix dimensions must agree");
+
+        static constexpr std::size_t size = L::size;
+
+        typename MatOperand<L>::type lhs;
+        typename MatOperand<R>::type rhs;
+
+        // (L * R) * v = L * (R * v)
+        constexpr Vec<size> apply(const Vec<size>& v) const
+        {
+            return lhs.apply(rhs.apply(v));
+        } // apply
+
+        constexpr Vec<size> column(const std::size_t& col) const
+        {
+            return lhs.apply(rhs.column(col));
+        } // column
+
+        constexpr operator Mat<size>() const
+        {
+            Mat<size> r{};
+
+            for(std::size_t j = 0; j < size; ++j)
+            {
+                Vec<size> c = column(j);
+
+                for(std::size_t i = 0; i < size; ++i)
+                {
+                    r.m[j * size + i] = c[i];
+                } // for
+            } // for
+
+            return r;
+        } // operator Mat
+    }; // MatProduct
+
+    template <typename L, typename R,
+              typename = typename std::enable_if<IsMatExpr<L>::value && IsMatExpr<R>::value>::type>
+    constexpr MatProduct<L, R> operator*(const L& lhs, const R& rhs)
+    {
+        return MatProduct<L, R>{lhs, rhs};
+    } // operator*
+
+    template <typename E,
+              typename = typename std::enable_if<IsMatExpr<E>::value>::type>
+    constexpr Vec<E::size> operator*(const E& e, const Vec<E::size>& v)
+    {
+        return e.apply(v);
+    } // operator*
+
+    template <typename E,
+              typename = typename std::enable_if<IsMatExpr<E>::value>::type>
+    constexpr Mat<E::size> eval(const E& e)
+    {
+        return Mat<E::size>(e);
+    } // eval
+
+    template <std::size_t N>
+    constexpr Mat<N> transpose(const Mat<N>& M)
+    {
+        Mat<N> r{};
+
+        for(std::size_t j = 0; j < N; ++j)
+        {
+            for(std::size_t i = 0; i < N; ++i)
+            {
+                r(i, j) = M(j, i);
+            } // for
+        } // for
+
+        return r;
+    } // transpose
+
+#pragma mark -
+#pragma mark Public - Transformations
+
+    constexpr Mat4 scale(const Vec3& s)
+    {
+        Mat4 r = Mat4::identity();
+
+        r(0, 0) = s[0];
+        r(1, 1) = s[1];
+        r(2, 2) = s[2];
+
+        return r;
+    } // scale
+
+    constexpr Mat4 translate(const Vec3& t)
+    {
+        Mat4 r = Mat4::identity();
+
+        r(0, 3) = t[0];
+        r(1, 3) = t[1];
+        r(2, 3) = t[2];
+
+        return r;
+    } // translate
+
+    // Same as glOrtho
+    constexpr Mat4 ortho(const Vec3& origin,
+                         const Vec3& size)
+    {
+        Mat4 r{};
+
+        r(0, 0) =  2.0f / size[0];
+        r(1, 1) =  2.0f / size[1];
+        r(2, 2) = -2.0f / size[2];
+        r(0, 3) = -(2.0f * origin[0] + size[0]) / size[0];
+        r(1, 3) = -(2.0f * origin[1] + size[1]) / size[1];
+        r(2, 3) = -(2.0f * origin[2] + size[2]) / size[2];
+        r(3, 3) =  1.0f;
+
+        return r;
+    } // ortho
+
+    // Same as gluLookAt
+    constexpr Mat4 lookAt(const Vec3& eye,
+                          const Vec3& center,
+                          const Vec3& up)
+    {
+        Vec3 N = normalize(eye - center);
+        Vec3 U = normalize(cross(up, N));
+        Vec3 V = cross(N, U);
+
+        Mat4 r{};
+
+        r(0, 0) = U[0]; r(0, 1) = U[1]; r(0, 2) = U[2]; r(0, 3) = -dot(U, eye);
+        r(1, 0) = V[0]; r(1, 1) = V[1]; r(1, 2) = V[2]; r(1, 3) = -dot(V, eye);
+        r(2, 0) = N[0]; r(2, 1) = N[1]; r(2, 2) = N[2]; r(2, 3) = -dot(N, eye);
+        r(3, 3) = 1.0f;
+
+        return r;
+    } // lookAt
+} // GLM
+
+#endif
+
+#endif
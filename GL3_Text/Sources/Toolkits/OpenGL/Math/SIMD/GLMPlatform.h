@@ -0,0 +1,60 @@
+/*
+     File: GLMPlatform.h
+ Abstract:
+ OpenGL scalar types for the math toolkit.
+
+ On OS X these come from the OpenGL framework.  Elsewhere the GL headers are
+ used when GLM_HAS_OPENGL is defined, otherwise just the scalar typedefs are
+ provided so the math can be built and benchmarked without a GL context.
+ GLM_HAS_OPENGL is 1 whenever the GL entry points are declared.
+
+ */
+
+#ifndef _OPENGL_MATH_PLATFORM_H_
+#define _OPENGL_MATH_PLATFORM_H_
+
+#if defined(__APPLE__)
+
+#import <OpenGL/OpenGL.h>
+
+#undef  GLM_HAS_OPENGL
+#define GLM_HAS_OPENGL 1
+
+#elif defined(GLM_HAS_OPENGL)
+
+#undef  GLM_HAS_OPENGL
+#define GLM_HAS_OPENGL 1
+
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES 1
+#endif
+
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+#else
+
+#define GLM_HAS_OPENGL 0
+
+typedef unsigned int   GLenum;
+typedef unsigned char  GLboolean;
+typedef unsigned int   GLbitfield;
+typedef signed char    GLbyte;
+typedef short          GLshort;
+typedef int            GLint;
+typedef int            GLsizei;
+typedef unsigned char  GLubyte;
+typedef unsigned short GLushort;
+typedef unsigned int   GLuint;
+typedef float          GLfloat;
+typedef float          GLclampf;
+typedef double         GLdouble;
+typedef double         GLclampd;
+typedef void           GLvoid;
+typedef char           GLchar;
+typedef long           GLintptr;
+typedef long           GLsizeiptr;
+
+#endif
+
+#endif
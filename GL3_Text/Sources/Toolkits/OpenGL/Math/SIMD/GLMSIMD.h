@@ -0,0 +1,582 @@
+/*
+     File: GLMSIMD.h
+ Abstract:
+ Vector and matrix types for the math toolkit.
+
+ On OS X this is <simd/simd.h>.  Elsewhere, or on OS X when GLM_SIMD_PORTABLE
+ is defined, a portable subset of the simd:: types used by the toolkit is
+ provided instead: float2, float3, float4 and float4x4 with the same size,
+ alignment and member names, the vector_* and matrix_* aliases, and
+ dot, cross, length, normalize, transpose and inverse.
+
+ The portable types are implemented with SSE2, AVX (two matrix columns per
+ register, fused multiply-add when __FMA__ is defined), NEON, or plain scalar
+ code, chosen at compile time; define GLM_SIMD_SCALAR to force the latter.
+ GLM_SIMD_BACKEND names the implementation that was picked.
+
+ GLM::sincospi replaces __sincospif, which is only available on OS X.
+
+ */
+
+#ifndef _OPENGL_MATH_SIMD_H_
+#define _OPENGL_MATH_SIMD_H_
+
+#if defined(__APPLE__) && !defined(GLM_SIMD_PORTABLE)
+
+#import <simd/simd.h>
+
+#define GLM_SIMD_BACKEND "simd"
+
+#elif defined(__cplusplus)
+
+#import <cmath>
+#import <cstddef>
+#import <type_traits>
+
+#if defined(GLM_SIMD_SCALAR)
+    #define GLM_SIMD_BACKEND "scalar"
+#elif defined(__AVX__)
+    #import <immintrin.h>
+    #define GLM_SIMD_SSE 1
+    #define GLM_SIMD_AVX 1
+    #define GLM_SIMD_BACKEND "avx"
+#elif defined(__SSE2__) || defined(_M_X64)
+    #import <emmintrin.h>
+    #define GLM_SIMD_SSE 1
+    #define GLM_SIMD_BACKEND "sse2"
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #import <arm_neon.h>
+    #define GLM_SIMD_NEON 1
+    #define GLM_SIMD_BACKEND "neon"
+#else
+    #define GLM_SIMD_BACKEND "scalar"
+#endif
+
+namespace GLM
+{
+    namespace SIMD
+    {
+#pragma mark -
+#pragma mark Private - Registers
+
+#if defined(GLM_SIMD_SSE)
+
+        typedef __m128 Native;
+
+        inline Native set(const float& x, const float& y, const float& z, const float& w) { return _mm_setr_ps(x, y, z, w); }
+        inline Native splat(const float& s)                  { return _mm_set1_ps(s); }
+        inline Native add(const Native& a, const Native& b)  { return _mm_add_ps(a, b); }
+        inline Native sub(const Native& a, const Native& b)  { return _mm_sub_ps(a, b); }
+        inline Native mul(const Native& a, const Native& b)  { return _mm_mul_ps(a, b); }
+        inline Native div(const Native& a, const Native& b)  { return _mm_div_ps(a, b); }
+        inline Native neg(const Native& a)                   { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+
+        // a * b + c
+        inline Native madd(const Native& a, const Native& b, const Native& c)
+        {
+#if defined(__FMA__)
+            return _mm_fmadd_ps(a, b, c);
+#else
+            return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+        } // madd
+
+        // Broadcasts lane I
+        template <int I>
+        inline Native lane(const Native& a)
+        {
+            return _mm_shuffle_ps(a, a, _MM_SHUFFLE(I, I, I, I));
+        } // lane
+
+        // (a.y, a.z, a.x, a.w)
+        inline Native yzx(const Native& a)
+        {
+            return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        } // yzx
+
+        inline float hadd3(const Native& a)
+        {
+            Native y = lane<1>(a);
+            Native z = lane<2>(a);
+
+            return _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(a, y), z));
+        } // hadd3
+
+        inline float hadd4(const Native& a)
+        {
+            Native s = _mm_add_ps(a, _mm_movehl_ps(a, a));
+
+            return _mm_cvtss_f32(_mm_add_ss(s, lane<1>(s)));
+        } // hadd4
+
+#elif defined(GLM_SIMD_NEON)
+
+        typedef float32x4_t Native;
+
+        inline Native set(const float& x, const float& y, const float& z, const float& w)
+        {
+            const float v[4] = {x, y, z, w};
+
+            return vld1q_f32(v);
+        } // set
+
+        inline Native splat(const float& s)                  { return vdupq_n_f32(s); }
+        inline Native add(const Native& a, const Native& b)  { return vaddq_f32(a, b); }
+        inline Native sub(const Native& a, const Native& b)  { return vsubq_f32(a, b); }
+        inline Native mul(const Native& a, const Native& b)  { return vmulq_f32(a, b); }
+        inline Native neg(const Native& a)                   { return vnegq_f32(a); }
+
+        inline Native div(const Native& a, const Native& b)
+        {
+#if defined(__aarch64__)
+            return vdivq_f32(a, b);
+#else
+            // Two Newton-Raphson steps on the reciprocal estimate
+            Native r = vrecpeq_f32(b);
+
+            r = vmulq_f32(vrecpsq_f32(b, r), r);
+            r = vmulq_f32(vrecpsq_f32(b, r), r);
+
+            return vmulq_f32(a, r);
+#endif
+        } // div
+
+        // a * b + c
+        inline Native madd(const Native& a, const Native& b, const Native& c)
+        {
+#if defined(__aarch64__)
+            return vfmaq_f32(c, a, b);
+#else
+            return vmlaq_f32(c, a, b);
+#endif
+        } // madd
+
+        // Broadcasts lane I
+        template <int I>
+        inline Native lane(const Native& a)
+        {
+#if defined(__aarch64__)
+            return vdupq_laneq_f32(a, I);
+#else
+            return vdupq_n_f32(vgetq_lane_f32(a, I));
+#endif
+        } // lane
+
+        // (a.y, a.z, a.x, a.w)
+        inline Native yzx(const Native& a)
+        {
+            return set(vgetq_lane_f32(a, 1), vgetq_lane_f32(a, 2), vgetq_lane_f32(a, 0), vgetq_lane_f32(a, 3));
+        } // yzx
+
+        inline float hadd3(const Native& a)
+        {
+            return vgetq_lane_f32(a, 0) + vgetq_lane_f32(a, 1) + vgetq_lane_f32(a, 2);
+        } // hadd3
+
+        inline float hadd4(const Native& a)
+        {
+            float32x2_t s = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+
+            return vget_lane_f32(vpadd_f32(s, s), 0);
+        } // hadd4
+
+#else
+
+        struct Native
+        {
+            float m[4];
+        }; // Native
+
+        inline Native set(const float& x, const float& y, const float& z, const float& w) { return Native{{x, y, z, w}}; }
+        inline Native splat(const float& s) { return Native{{s, s, s, s}}; }
+
+        inline Native add(const Native& a, const Native& b) { return Native{{a.m[0] + b.m[0], a.m[1] + b.m[1], a.m[2] + b.m[2], a.m[3] + b.m[3]}}; }
+        inline Native sub(const Native& a, const Native& b) { return Native{{a.m[0] - b.m[0], a.m[1] - b.m[1], a.m[2] - b.m[2], a.m[3] - b.m[3]}}; }
+        inline Native mul(const Native& a, const Native& b) { return Native{{a.m[0] * b.m[0], a.m[1] * b.m[1], a.m[2] * b.m[2], a.m[3] * b.m[3]}}; }
+        inline Native div(const Native& a, const Native& b) { return Native{{a.m[0] / b.m[0], a.m[1] / b.m[1], a.m[2] / b.m[2], a.m[3] / b.m[3]}}; }
+        inline Native neg(const Native& a)                  { return Native{{-a.m[0], -a.m[1], -a.m[2], -a.m[3]}}; }
+
+        inline Native madd(const Native& a, const Native& b, const Native& c) { return add(mul(a, b), c); }
+
+        template <int I>
+        inline Native lane(const Native& a) { return splat(a.m[I]); }
+
+        inline Native yzx(const Native& a) { return Native{{a.m[1], a.m[2], a.m[0], a.m[3]}}; }
+
+        inline float hadd3(const Native& a) { return a.m[0] + a.m[1] + a.m[2]; }
+        inline float hadd4(const Native& a) { return (a.m[0] + a.m[1]) + (a.m[2] + a.m[3]); }
+
+#endif
+    } // SIMD
+} // GLM
+
+namespace simd
+{
+#pragma mark -
+#pragma mark Public - Vectors
+
+    struct alignas(8) float2
+    {
+        float x, y;
+
+        float2() = default;
+
+        float2(const float& s)
+        : x(s), y(s) {}
+
+        float2(const float& _x, const float& _y)
+        : x(_x), y(_y) {}
+
+              float& operator[](const std::size_t& i)       { return (&x)[i]; }
+        const float& operator[](const std::size_t& i) const { return (&x)[i]; }
+    }; // float2
+
+    struct float3;
+
+    // Views of the leading lanes of a wider vector, so that v.xyz = u leaves
+    // v.w untouched
+    struct float2_view
+    {
+        float x, y;
+
+        operator float2() const { return float2(x, y); }
+
+        float2_view& operator=(const float2& v) { x = v.x; y = v.y; return *this; }
+    }; // float2_view
+
+    struct float3_view
+    {
+        float x, y, z;
+
+        inline operator float3() const;
+
+        inline float3_view& operator=(const float3& v);
+    }; // float3_view
+
+    // 16 bytes like the OS X type; lane 3 is padding and may hold anything
+    struct alignas(16) float3
+    {
+        union
+        {
+            GLM::SIMD::Native v;
+
+            struct { float x, y, z; };
+
+            float2_view xy;
+        };
+
+        float3() = default;
+
+        float3(const float& s)
+        : v(GLM::SIMD::set(s, s, s, 0.0f)) {}
+
+        float3(const float& _x, const float& _y, const float& _z)
+        : v(GLM::SIMD::set(_x, _y, _z, 0.0f)) {}
+
+        explicit float3(const GLM::SIMD::Native& n)
+        : v(n) {}
+
+              float& operator[](const std::size_t& i)       { return (&x)[i]; }
+        const float& operator[](const std::size_t& i) const { return (&x)[i]; }
+    }; // float3
+
+    struct alignas(16) float4
+    {
+        union
+        {
+            GLM::SIMD::Native v;
+
+            struct { float x, y, z, w; };
+
+            float2_view xy;
+            float3_view xyz;
+        };
+
+        float4() = default;
+
+        float4(const float& s)
+        : v(GLM::SIMD::splat(s)) {}
+
+        float4(const float& _x, const float& _y, const float& _z, const float& _w)
+        : v(GLM::SIMD::set(_x, _y, _z, _w)) {}
+
+        explicit float4(const GLM::SIMD::Native& n)
+        : v(n) {}
+
+              float& operator[](const std::size_t& i)       { return (&x)[i]; }
+        const float& operator[](const std::size_t& i) const { return (&x)[i]; }
+    }; // float4
+
+    inline float3_view::operator float3() const
+    {
+        return float3(x, y, z);
+    } // operator float3
+
+    inline float3_view& float3_view::operator=(const float3& v)
+    {
+        x = v.x;
+        y = v.y;
+        z = v.z;
+
+        return *this;
+    } // operator=
+
+    static_assert(sizeof(float2) == 8 && sizeof(float3) == 16 && sizeof(float4) == 16,
+                  "Portable simd vectors must match the OS X layout");
+
+    static_assert(std::is_trivially_copyable<float3>::value && std::is_trivially_copyable<float4>::value,
+                  "Portable simd vectors must be trivially copyable");
+
+#pragma mark -
+#pragma mark Public - Vectors - Operators
+
+    template <typename T> struct is_native : std::false_type {};
+
+    template <> struct is_native<float3> : std::true_type {};
+    template <> struct is_native<float4> : std::true_type {};
+
+    template <typename T>
+    using if_native = typename std::enable_if<is_native<T>::value, T>::type;
+
+    template <typename T> inline if_native<T> operator+(const T& a, const T& b) { return T(GLM::SIMD::add(a.v, b.v)); }
+    template <typename T> inline if_native<T> operator-(const T& a, const T& b) { return T(GLM::SIMD::sub(a.v, b.v)); }
+    template <typename T> inline if_native<T> operator*(const T& a, const T& b) { return T(GLM::SIMD::mul(a.v, b.v)); }
+    template <typename T> inline if_native<T> operator/(const T& a, const T& b) { return T(GLM::SIMD::div(a.v, b.v)); }
+    template <typename T> inline if_native<T> operator-(const T& a)             { return T(GLM::SIMD::neg(a.v)); }
+
+    template <typename T> inline if_native<T> operator*(const float& s, const T& a) { return T(GLM::SIMD::mul(GLM::SIMD::splat(s), a.v)); }
+    template <typename T> inline if_native<T> operator*(const T& a, const float& s) { return T(GLM::SIMD::mul(a.v, GLM::SIMD::splat(s))); }
+    template <typename T> inline if_native<T> operator/(const T& a, const float& s) { return T(GLM::SIMD::div(a.v, GLM::SIMD::splat(s))); }
+
+    template <typename T> inline if_native<T>& operator+=(T& a, const T& b)     { a.v = GLM::SIMD::add(a.v, b.v); return a; }
+    template <typename T> inline if_native<T>& operator-=(T& a, const T& b)     { a.v = GLM::SIMD::sub(a.v, b.v); return a; }
+    template <typename T> inline if_native<T>& operator*=(T& a, const float& s) { a.v = GLM::SIMD::mul(a.v, GLM::SIMD::splat(s)); return a; }
+
+    inline float2 operator+(const float2& a, const float2& b) { return float2(a.x + b.x, a.y + b.y); }
+    inline float2 operator-(const float2& a, const float2& b) { return float2(a.x - b.x, a.y - b.y); }
+    inline float2 operator*(const float2& a, const float2& b) { return float2(a.x * b.x, a.y * b.y); }
+    inline float2 operator*(const float& s,  const float2& a) { return float2(s * a.x, s * a.y); }
+    inline float2 operator*(const float2& a, const float& s)  { return float2(a.x * s, a.y * s); }
+    inline float2 operator-(const float2& a)                  { return float2(-a.x, -a.y); }
+
+#pragma mark -
+#pragma mark Public - Vectors - Geometry
+
+    inline float dot(const float2& a, const float2& b) { return a.x * b.x + a.y * b.y; }
+    inline float dot(const float3& a, const float3& b) { return GLM::SIMD::hadd3(GLM::SIMD::mul(a.v, b.v)); }
+    inline float dot(const float4& a, const float4& b) { return GLM::SIMD::hadd4(GLM::SIMD::mul(a.v, b.v)); }
+
+    // a x b = (a * b.yzx - a.yzx * b).yzx
+    inline float3 cross(const float3& a, const float3& b)
+    {
+        using namespace GLM::SIMD;
+
+        return float3(yzx(sub(mul(a.v, yzx(b.v)), mul(yzx(a.v), b.v))));
+    } // cross
+
+    template <typename T>
+    inline float length_squared(const T& a)
+    {
+        return dot(a, a);
+    } // length_squared
+
+    template <typename T>
+    inline float length(const T& a)
+    {
+        return std::sqrt(dot(a, a));
+    } // length
+
+    template <typename T>
+    inline T normalize(const T& a)
+    {
+        return (1.0f / std::sqrt(dot(a, a))) * a;
+    } // normalize
+
+#pragma mark -
+#pragma mark Public - Matrices
+
+    struct alignas(16) float4x4
+    {
+        float4 columns[4];
+
+        float4x4() = default;
+
+        explicit float4x4(const float& s)
+        : columns{float4(s, 0.0f, 0.0f, 0.0f),
+                  float4(0.0f, s, 0.0f, 0.0f),
+                  float4(0.0f, 0.0f, s, 0.0f),
+                  float4(0.0f, 0.0f, 0.0f, s)} {}
+
+        explicit float4x4(const float4& d)
+        : columns{float4(d.x, 0.0f, 0.0f, 0.0f),
+                  float4(0.0f, d.y, 0.0f, 0.0f),
+                  float4(0.0f, 0.0f, d.z, 0.0f),
+                  float4(0.0f, 0.0f, 0.0f, d.w)} {}
+
+        float4x4(const float4& c0, const float4& c1, const float4& c2, const float4& c3)
+        : columns{c0, c1, c2, c3} {}
+
+              float4& operator[](const std::size_t& i)       { return columns[i]; }
+        const float4& operator[](const std::size_t& i) const { return columns[i]; }
+    }; // float4x4
+
+    static_assert(sizeof(float4x4) == 64 && std::is_trivially_copyable<float4x4>::value,
+                  "Portable simd matrices must be layout compatible with GLfloat[16]");
+
+    // M * v
+    inline float4 operator*(const float4x4& M, const float4& v)
+    {
+        using namespace GLM::SIMD;
+
+        Native r = mul(M.columns[0].v, lane<0>(v.v));
+
+        r = madd(M.columns[1].v, lane<1>(v.v), r);
+        r = madd(M.columns[2].v, lane<2>(v.v), r);
+        r = madd(M.columns[3].v, lane<3>(v.v), r);
+
+        return float4(r);
+    } // operator*
+
+    // A * B
+    inline float4x4 operator*(const float4x4& A, const float4x4& B)
+    {
+        float4x4 C;
+
+#if defined(GLM_SIMD_AVX)
+        // Two columns of the product per 256-bit register
+        const float* pB = &B.columns[0].x;
+
+        float* pC = &C.columns[0].x;
+
+        __m256 a0 = _mm256_broadcast_ps(&A.columns[0].v);
+        __m256 a1 = _mm256_broadcast_ps(&A.columns[1].v);
+        __m256 a2 = _mm256_broadcast_ps(&A.columns[2].v);
+        __m256 a3 = _mm256_broadcast_ps(&A.columns[3].v);
+
+        for(int j = 0; j < 16; j += 8)
+        {
+            __m256 b = _mm256_loadu_ps(pB + j);
+
+#if defined(__FMA__)
+            __m256 c = _mm256_mul_ps(a0, _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0)));
+
+            c = _mm256_fmadd_ps(a1, _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1)), c);
+            c = _mm256_fmadd_ps(a2, _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2)), c);
+            c = _mm256_fmadd_ps(a3, _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)), c);
+#else
+            __m256 c01 = _mm256_add_ps(_mm256_mul_ps(a0, _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0))),
+                                       _mm256_mul_ps(a1, _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1))));
+            __m256 c23 = _mm256_add_ps(_mm256_mul_ps(a2, _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2))),
+                                       _mm256_mul_ps(a3, _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3))));
+            __m256 c   = _mm256_add_ps(c01, c23);
+#endif
+
+            _mm256_storeu_ps(pC + j, c);
+        } // for
+#else
+        C.columns[0] = A * B.columns[0];
+        C.columns[1] = A * B.columns[1];
+        C.columns[2] = A * B.columns[2];
+        C.columns[3] = A * B.columns[3];
+#endif
+
+        return C;
+    } // operator*
+
+    inline float4x4 transpose(const float4x4& M)
+    {
+#if defined(GLM_SIMD_SSE)
+        __m128 c0 = M.columns[0].v;
+        __m128 c1 = M.columns[1].v;
+        __m128 c2 = M.columns[2].v;
+        __m128 c3 = M.columns[3].v;
+
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        return float4x4(float4(c0), float4(c1), float4(c2), float4(c3));
+#else
+        return float4x4(float4(M.columns[0].x, M.columns[1].x, M.columns[2].x, M.columns[3].x),
+                        float4(M.columns[0].y, M.columns[1].y, M.columns[2].y, M.columns[3].y),
+                        float4(M.columns[0].z, M.columns[1].z, M.columns[2].z, M.columns[3].z),
+                        float4(M.columns[0].w, M.columns[1].w, M.columns[2].w, M.columns[3].w));
+#endif
+    } // transpose
+
+    // Inverse by cofactor expansion.  Singular matrices yield infinities,
+    // as on OS X.
+    inline float4x4 inverse(const float4x4& M)
+    {
+        const float* m = &M.columns[0].x;
+
+        float r[16];
+
+        r[0]  =  m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+        r[4]  = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+        r[8]  =  m[4] * m[9]  * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+        r[12] = -m[4] * m[9]  * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+        r[1]  = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+        r[5]  =  m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+        r[9]  = -m[0] * m[9]  * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+        r[13] =  m[0] * m[9]  * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+        r[2]  =  m[1] * m[6]  * m[15] - m[1] * m[7]  * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7]  - m[13] * m[3] * m[6];
+        r[6]  = -m[0] * m[6]  * m[15] + m[0] * m[7]  * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7]  + m[12] * m[3] * m[6];
+        r[10] =  m[0] * m[5]  * m[15] - m[0] * m[7]  * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7]  - m[12] * m[3] * m[5];
+        r[14] = -m[0] * m[5]  * m[14] + m[0] * m[6]  * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6]  + m[12] * m[2] * m[5];
+        r[3]  = -m[1] * m[6]  * m[11] + m[1] * m[7]  * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9]  * m[2] * m[7]  + m[9]  * m[3] * m[6];
+        r[7]  =  m[0] * m[6]  * m[11] - m[0] * m[7]  * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8]  * m[2] * m[7]  - m[8]  * m[3] * m[6];
+        r[11] = -m[0] * m[5]  * m[11] + m[0] * m[7]  * m[9]  + m[4] * m[1] * m[11] - m[4] * m[3] * m[9]  - m[8]  * m[1] * m[7]  + m[8]  * m[3] * m[5];
+        r[15] =  m[0] * m[5]  * m[10] - m[0] * m[6]  * m[9]  - m[4] * m[1] * m[10] + m[4] * m[2] * m[9]  + m[8]  * m[1] * m[6]  - m[8]  * m[2] * m[5];
+
+        const float d = 1.0f / (m[0] * r[0] + m[1] * r[4] + m[2] * r[8] + m[3] * r[12]);
+
+        return float4x4(d * float4(r[0],  r[1],  r[2],  r[3]),
+                        d * float4(r[4],  r[5],  r[6],  r[7]),
+                        d * float4(r[8],  r[9],  r[10], r[11]),
+                        d * float4(r[12], r[13], r[14], r[15]));
+    } // inverse
+} // simd
+
+typedef simd::float2   vector_float2;
+typedef simd::float3   vector_float3;
+typedef simd::float4   vector_float4;
+typedef simd::float4x4 matrix_float4x4;
+
+static const matrix_float4x4 matrix_identity_float4x4 = matrix_float4x4(1.0f);
+
+#endif
+
+#ifdef __cplusplus
+
+#import <cmath>
+
+namespace GLM
+{
+    // Sine and cosine of pi * a.  Exact for multiples of 1/2, so rotations
+    // by 90, 180 and 270 degrees have no round-off.
+    inline void sincospi(const float& a, float* pSin, float* pCos)
+    {
+#if defined(__APPLE__)
+        __sincospif(a, pSin, pCos);
+#else
+        // a = q/2 + r with |r| <= 1/4; both are exact in single precision
+        const float q = std::nearbyint(2.0f * a);
+        const float r = a - 0.5f * q;
+        const float t = 3.14159265358979323846f * r;
+
+        const float s = (r != 0.0f) ? std::sin(t) : 0.0f;
+        const float c = (r != 0.0f) ? std::cos(t) : 1.0f;
+
+        switch(static_cast<long long>(q) & 3)
+        {
+            case 0:  *pSin =  s; *pCos =  c; break;
+            case 1:  *pSin =  c; *pCos = -s; break;
+            case 2:  *pSin = -s; *pCos = -c; break;
+            default: *pSin = -c; *pCos =  s; break;
+        } // switch
+#endif
+    } // sincospi
+} // GLM
+
+#endif
+
+#endif
@@ -50,17 +50,13 @@
 #ifndef _OPENGL_MATH_TRANSFORMS_H_
 #define _OPENGL_MATH_TRANSFORMS_H_
 
-#import <simd/simd.h>
-#import <OpenGL/OpenGL.h>
+#import "GLMPlatform.h"
+#import "GLMSIMD.h"
 
 #ifdef __cplusplus
 
 namespace GLM
 {
-    void uniform(const GLint& location,
-                 const bool& transpose,
-                 const simd::float4x4& M);
-    
     simd::float4x4 scale(const GLfloat& x,
                          const GLfloat& y,
                          const GLfloat& z);
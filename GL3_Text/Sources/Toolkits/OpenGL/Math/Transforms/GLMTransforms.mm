@@ -53,43 +53,9 @@
 #import <cmath>
 #import <iostream>
 
-#import <OpenGL/gl3.h>
-
 #import "GLMConstants.h"
 #import "GLMTransforms.h"
 
-#pragma mark -
-#pragma mark Public - Transformations - Load
-
-void GLM::uniform(const GLint& location,
-                  const bool& transpose,
-                  const simd::float4x4& M)
-{
-    GLfloat m[16];
-    
-    m[0] = M.columns[0].x;
-    m[1] = M.columns[1].x;
-    m[2] = M.columns[2].x;
-    m[3] = M.columns[3].x;
-    
-    m[4] = M.columns[0].y;
-    m[5] = M.columns[1].y;
-    m[6] = M.columns[2].y;
-    m[7] = M.columns[3].y;
-    
-    m[8]  = M.columns[0].z;
-    m[9]  = M.columns[1].z;
-    m[10] = M.columns[2].z;
-    m[11] = M.columns[3].z;
-    
-    m[12] = M.columns[0].w;
-    m[13] = M.columns[1].w;
-    m[14] = M.columns[2].w;
-    m[15] = M.columns[3].w;
-    
-    glUniformMatrix4fv(location, 1, GLboolean(transpose), m);
-} // uniform
-
 #pragma mark -
 #pragma mark Public - Transformations - Scale
 
@@ -146,7 +112,7 @@ simd::float4x4 GLM::rotate(const GLfloat& angle,
     
     // Computes the sine and cosine of pi times angle (measured in radians)
     // faster and gives exact results for angle = 90, 180, 270, etc.
-    __sincospif(a, &s, &c);
+    GLM::sincospi(a, &s, &c);
     
     float k = 1.0f - c;
     
@@ -102,6 +102,22 @@ namespace GLU
     // Delete all the program object and shaders
     void ProgramDelete(ProgramRef pProgram);
     
+    // Acquire a program of vertex and fragment shader sources, linked with
+    // attribute and fragment locations, shared by every consumer of the
+    // same sources and locations whose current context is in the same
+    // share group.  The first consumer compiles and links it, and the
+    // others share its object.  Release it with the same share group
+    // current.
+    ProgramRef ProgramAcquire(const String& rVertex,
+                              const String& rFragment,
+                              const UInts& rAttribKeys,
+                              const Strings& rAttribValues,
+                              const UInts& rFragKeys,
+                              const Strings& rFragValues);
+    
+    // Release a shared program, deleting it with its last consumer
+    void ProgramRelease(ProgramRef pProgram);
+    
     // Add attribute locations using key-value vector pairs
     bool ProgramAddAttributes(const UInts    &rKeys,
                               const Strings  &rValues,
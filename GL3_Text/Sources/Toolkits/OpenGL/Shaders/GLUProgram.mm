@@ -80,6 +80,23 @@ namespace GLU
     }; // Program
     
     typedef struct Program  Program;
+    
+    // A linked program shared by the consumers of the same shader sources
+    // and locations in the same share group
+    struct ProgramEntry
+    {
+        size_t            mnHash;         // Hash of the key
+        String            m_Key;          // Sources and locations
+        CGLShareGroupObj  mpShareGroup;   // Contexts the program object is valid in
+        GLuint            mnRefs;         // Consumers
+        ProgramRef        mpProgram;
+    }; // ProgramEntry
+    
+    typedef struct ProgramEntry  ProgramEntry;
+    
+    // Shared programs of every share group, few enough for a linear
+    // search of their hashes
+    static std::vector<ProgramEntry>  gPrograms;
 } // GLU
 
 #pragma mark -
@@ -133,7 +150,7 @@ static void GLUProgramDeleteShaders(GLU::ProgramRef pProgram)
 // Delete program object
 static void GLUProgramDeleteProgObj(GLU::ProgramRef pProgram)
 {
-    if(!pProgram->mnPID)
+    if(pProgram->mnPID)
     {
         glDeleteProgram(pProgram->mnPID);
     } // if
@@ -737,7 +754,7 @@ static GLU::ProgramRef GLUProgramCreate(const GLU::String &rVertex,
     
     try
     {
-        pProgram = new GLU::Program;
+        pProgram = new GLU::Program();
         
         if(!GLUProgramAcquireShaderSources(rVertex, rFragment, rGeometry, pProgram))
         {
@@ -752,6 +769,8 @@ static GLU::ProgramRef GLUProgramCreate(const GLU::String &rVertex,
     {
         GLUProgramDelete(pProgram);
         
+        pProgram = nullptr;
+        
         NSLog(@">> ERROR: %@", pString);
     } // catch
     
@@ -768,7 +787,7 @@ static GLU::ProgramRef GLUProgramCreate(CFStringRef pVertex,
     
     try
     {
-        pProgram = new GLU::Program;
+        pProgram = new GLU::Program();
         
         if(!GLUProgramAcquireShaderSources(pVertex, pFragment, pGeometry, pProgram))
         {
@@ -783,6 +802,8 @@ static GLU::ProgramRef GLUProgramCreate(CFStringRef pVertex,
     {
         GLUProgramDelete(pProgram);
         
+        pProgram = nullptr;
+        
         NSLog(@">> ERROR: %@", pString);
     } // catch
     
@@ -843,6 +864,74 @@ static GLU::ProgramRef GLUProgramCreateAtPath(CFStringRef pVertex,
     return pProgram;
 } // GLUProgramsCreateAtPath
 
+#pragma mark -
+#pragma mark Private - Utilities - Registry
+
+// The key of a shared program, its sources and then its locations, each
+// terminated so that none can be confused with the next
+static GLU::String GLUProgramKey(const GLU::String& rVertex,
+                                 const GLU::String& rFragment,
+                                 const GLU::UInts& rAttribKeys,
+                                 const GLU::Strings& rAttribValues,
+                                 const GLU::UInts& rFragKeys,
+                                 const GLU::Strings& rFragValues)
+{
+    GLU::String key;
+    
+    key.reserve(rVertex.size() + rFragment.size() + 256);
+    
+    key += rVertex;
+    key += '\0';
+    key += rFragment;
+    key += '\0';
+    
+    for(size_t i = 0; (i < rAttribKeys.size()) && (i < rAttribValues.size()); ++i)
+    {
+        key += std::to_string(rAttribKeys[i]);
+        key += '=';
+        key += rAttribValues[i];
+        key += '\0';
+    } // for
+    
+    // Attribute and fragment locations are told apart
+    key += '\0';
+    
+    for(size_t i = 0; (i < rFragKeys.size()) && (i < rFragValues.size()); ++i)
+    {
+        key += std::to_string(rFragKeys[i]);
+        key += '=';
+        key += rFragValues[i];
+        key += '\0';
+    } // for
+    
+    return key;
+} // GLUProgramKey
+
+// Compile and link a program for the registry, with its locations
+static GLU::ProgramRef GLUProgramCreateLinked(const GLU::String& rVertex,
+                                              const GLU::String& rFragment,
+                                              const GLU::UInts& rAttribKeys,
+                                              const GLU::Strings& rAttribValues,
+                                              const GLU::UInts& rFragKeys,
+                                              const GLU::Strings& rFragValues)
+{
+    GLU::ProgramRef pProgram = GLUProgramCreate(rVertex, rFragment, "");
+    
+    if(pProgram != nullptr)
+    {
+        if(!GLU::ProgramAddAttributes(rAttribKeys, rAttribValues, pProgram)
+           || !GLU::ProgramAddFragments(rFragKeys, rFragValues, pProgram)
+           || !GLUProgramFinalize(pProgram))
+        {
+            GLUProgramDelete(pProgram);
+            
+            pProgram = nullptr;
+        } // if
+    } // if
+    
+    return pProgram;
+} // GLUProgramCreateLinked
+
 #pragma mark -
 #pragma mark Public - Utilities - Constructors
 
@@ -902,7 +991,7 @@ GLU::ProgramRef GLU::ProgramCreateCopy(GLU::ProgramRef pProgramSrc)
     {
         try
         {
-            pProgramDst = new GLU::Program;
+            pProgramDst = new GLU::Program();
             
             if(!GLUProgramCopy(pProgramSrc, pProgramDst))
             {
@@ -917,6 +1006,8 @@ GLU::ProgramRef GLU::ProgramCreateCopy(GLU::ProgramRef pProgramSrc)
         {
             GLUProgramDelete(pProgramDst);
             
+            pProgramDst = nullptr;
+            
             NSLog(@">> ERROR: %@", pString);
         } // catch
     } // if
@@ -936,6 +1027,87 @@ void GLU::ProgramDelete(GLU::ProgramRef pProgram)
     } // if
 } // GLUProgramDelete
 
+#pragma mark -
+#pragma mark Public - Utilities - Registry
+
+// Acquire a linked program shared by every consumer of the same sources
+// and locations in the share group of the current context
+GLU::ProgramRef GLU::ProgramAcquire(const GLU::String& rVertex,
+                                    const GLU::String& rFragment,
+                                    const GLU::UInts& rAttribKeys,
+                                    const GLU::Strings& rAttribValues,
+                                    const GLU::UInts& rFragKeys,
+                                    const GLU::Strings& rFragValues)
+{
+    GLU::ProgramRef pProgram = nullptr;
+    
+    try
+    {
+        GLU::ProgramEntry entry;
+        
+        entry.m_Key  = GLUProgramKey(rVertex, rFragment, rAttribKeys, rAttribValues, rFragKeys, rFragValues);
+        entry.mnHash = std::hash<GLU::String>()(entry.m_Key);
+        
+        entry.mpShareGroup = CGLGetShareGroup(CGLGetCurrentContext());
+        
+        for(GLU::ProgramEntry& rEntry : GLU::gPrograms)
+        {
+            if((rEntry.mnHash == entry.mnHash)
+               && (rEntry.mpShareGroup == entry.mpShareGroup)
+               && (rEntry.m_Key == entry.m_Key))
+            {
+                rEntry.mnRefs++;
+                
+                return rEntry.mpProgram;
+            } // if
+        } // for
+        
+        pProgram = GLUProgramCreateLinked(rVertex, rFragment, rAttribKeys, rAttribValues, rFragKeys, rFragValues);
+        
+        if(pProgram != nullptr)
+        {
+            entry.mnRefs    = 1;
+            entry.mpProgram = pProgram;
+            
+            GLU::gPrograms.push_back(std::move(entry));
+        } // if
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: OpenGL Program - Failed allocating memory for the program registry: \"%s\"", ba.what());
+        
+        GLU::ProgramDelete(pProgram);
+        
+        pProgram = nullptr;
+    } // catch
+    
+    return pProgram;
+} // ProgramAcquire
+
+// Release a shared program, deleting it with its last consumer
+void GLU::ProgramRelease(GLU::ProgramRef pProgram)
+{
+    if(pProgram != nullptr)
+    {
+        for(auto pIter = GLU::gPrograms.begin(); pIter != GLU::gPrograms.end(); ++pIter)
+        {
+            if(pIter->mpProgram == pProgram)
+            {
+                if(--pIter->mnRefs == 0)
+                {
+                    GLUProgramDelete(pIter->mpProgram);
+                    
+                    GLU::gPrograms.erase(pIter);
+                } // if
+                
+                return;
+            } // if
+        } // for
+        
+        NSLog(@">> WARNING: OpenGL Program - Released a program that is not shared!");
+    } // if
+} // ProgramRelease
+
 #pragma mark -
 #pragma mark Public - Utilities - Attributes
 
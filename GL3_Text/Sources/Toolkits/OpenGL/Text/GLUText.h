@@ -142,6 +142,74 @@ namespace GLU
     // Delete OpenGL text Object
     void TextDelete(TextRef pText);
     
+    // Counters of the text cache
+    struct TextCacheStats
+    {
+        GLuint      mnHits;         // Texts created from cached vertices
+        GLuint      mnMisses;       // Texts laid out and uploaded
+        GLuint      mnEvictions;    // Vertices deleted to stay within the budget
+        GLuint      mnEntries;      // Vertices cached
+        GLsizeiptr  mnBytes;        // GPU bytes of the cached vertices
+        GLsizeiptr  mnBudget;       // GPU bytes the cache may hold
+    }; // TextCacheStats
+    
+    typedef struct TextCacheStats  TextCacheStats;
+    
+    // Texts created from strings keep their glyph vertices in a cache when
+    // they are deleted.  A text created again with the same string, font,
+    // size, alignment, colors and projection in the same share group takes
+    // them back, without laying out the string or uploading vertices.  Each
+    // share group has a cache, whose least recently deleted vertices are
+    // evicted beyond a budget of GPU bytes.
+    void TextCacheSetBudget(const GLsizeiptr& rBytes);
+    
+    // Get the counters of the text cache of the current share group
+    TextCacheStats TextCacheGetStats();
+    
+    // Delete every cached vertices of the current share group, before its
+    // last OpenGL context is torn down
+    void TextCachePurge();
+    
+    // Change the string of a text created from a string, keeping its font,
+    // size, alignment and colors.  Only the vertices of the glyphs that
+    // changed are uploaded when the glyph count is unchanged, otherwise
+    // just the vao is recreated.  Glyphs new to the atlas are rasterized.
+    bool TextSetString(CFStringRef pString,
+                       TextRef pText);
+    
+    // Change the string of a text created from a string
+    bool TextSetString(const String& rString,
+                       TextRef pText);
+    
+    // Change the attributed string of a text
+    bool TextSetAttributedString(CFAttributedStringRef pAttrString,
+                                 TextRef pText);
+    
+    // Change the string of a text created from a string on a worker thread,
+    // which lays it out and generates the fields of its new glyphs.  The
+    // text shows its previous string until the next display, or update,
+    // after the layout is done, when the new glyphs are uploaded through a
+    // pixel buffer.  Strings set meanwhile replace one another, and only
+    // the latest is laid out next.  A text for a long string is best
+    // created from a short placeholder and then set asynchronously.
+    bool TextSetStringAsync(CFStringRef pString,
+                            TextRef pText);
+    
+    // Change the string of a text created from a string on a worker thread
+    bool TextSetStringAsync(const String& rString,
+                            TextRef pText);
+    
+    // Change the attributed string of a text on a worker thread
+    bool TextSetAttributedStringAsync(CFAttributedStringRef pAttrString,
+                                      TextRef pText);
+    
+    // Take the string of a text laid out on a worker thread, if it is done,
+    // as displaying it does.  True if the glyphs of the text changed.
+    bool TextUpdate(TextRef pText);
+    
+    // Whether a string of a text is still laid out on a worker thread
+    bool TextIsPending(const TextRef pText);
+    
     // Update field-of-view for prespective correct text
     void TextSetFieldOfView(const GLfloat& rFovy,
                             TextRef pText);
@@ -173,6 +241,41 @@ namespace GLU
     
     // Render a text into an OpenGL view
     void TextDisplay(const TextRef pText);
+    
+    // Render texts into an OpenGL view.  The transformations of all the
+    // texts are uploaded together, with one buffer update.  Glyphs are
+    // rasterized for the size of a text on screen, from its bounds, zoom
+    // and field of view, and again on a worker thread when zooming crosses
+    // a power of two, whatever the font size it was created with.
+    void TextDisplay(const TextRef * const pTexts,
+                     const GLuint& rCount);
+    
+    // Opaque data reference to a batch of texts drawn together
+    typedef struct TextBatch *TextBatchRef;
+    
+    // Create a batch of up to 64 perspective and non-perspective texts,
+    // drawn by a single program from a single vertex buffer
+    TextBatchRef TextBatchCreate();
+    
+    // Delete the batch.  Its texts are not deleted.
+    void TextBatchDelete(TextBatchRef pBatch);
+    
+    // Add a text to the batch, returns false if it is full.  Texts must be
+    // removed from their batches before they are deleted.
+    bool TextBatchAdd(TextRef pText,
+                      TextBatchRef pBatch);
+    
+    // Remove a text from the batch
+    void TextBatchRemove(const TextRef pText,
+                         TextBatchRef pBatch);
+    
+    // Remove every text from the batch
+    void TextBatchClear(TextBatchRef pBatch);
+    
+    // Render the texts of the batch without clearing the framebuffer.
+    // Their glyphs are sorted by blending factors and atlas page, so there
+    // is a draw call per distinct pair rather than per text.
+    void TextBatchDisplay(TextBatchRef pBatch);
 } // GLU
 
 #endif
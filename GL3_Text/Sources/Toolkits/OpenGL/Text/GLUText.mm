@@ -50,6 +50,17 @@
 #pragma mark -
 #pragma mark Headers
 
+// C math functions
+#import <cmath>
+
+// STL algorithms and containers
+#import <algorithm>
+#import <list>
+#import <unordered_map>
+
+// Grand Central Dispatch, for laying out strings on worker threads
+#import <dispatch/dispatch.h>
+
 // OpenGL core profile
 #import <OpenGL/gl3.h>
 
@@ -57,11 +68,13 @@
 #import "GLMConstants.h"
 
 // OpenGL math utilities
+#import "GLMMatrix.h"
 #import "GLMTransforms.h"
 
 // OpenGL utilities header
+#import "GLUGlyphAtlas.h"
 #import "GLUProgram.h"
-#import "GLUTexture.h"
+#import "GLUUniformArena.h"
 #import "GLUVertexArray.h"
 
 // OpenGL text header
@@ -75,191 +88,720 @@ namespace GLU
     struct TextUniforms
     {
         GLuint	mnSampler2D;	// Sampler 2D for a texture
-        GLuint  mnMVP;			// Model-view-Projection uniform
     }; // TextUniforms
     
     typedef struct TextUniforms  TextUniforms;
     
-    union TextTransform
+    // Contents of the std140 "Transforms" uniform block of the text
+    // programs.  The block is declared row_major, so the simd matrices,
+    // which multiply row vectors, are staged without transposing them.
+    struct TextBlock
     {
-        vector_float4 m_Ortho2D;	// Orthographic 2D vector transform
-        
-        struct
-        {
-            GLfloat          mnZoom;		// Zooming within a viewport
-            GLfloat          mnFovy;		// Field-of-view within a viewport
-            matrix_float4x4  m_ModelView;	// Model-view transformation matrix for perspective correct text
-        };
+        matrix_float4x4  m_MVP;			// Model-view-projection for perspective correct text
+        vector_float4    m_Ortho2D;		// Orthographic 2D vector transform
+    }; // TextBlock
+    
+    typedef struct TextBlock  TextBlock;
+    
+    static_assert(sizeof(TextBlock) == 80, "TextBlock must match the std140 layout of the Transforms block");
+    
+    // Projection of a perspective correct text
+    enum TextProjection
+    {
+        kTextProjectionPerspective = 0,	// Set by TextSetMVP
+        kTextProjectionFrustum			// Set by TexSetPrespective
+    }; // TextProjection
+    
+    // Transformations invalidated since the text was last displayed
+    enum TextDirty
+    {
+        kTextDirtyModelView  = 1 << 0,
+        kTextDirtyProjection = 1 << 1,
+        kTextDirtyOrtho2D    = 1 << 2
+    }; // TextDirty
+    
+    // The setters only record the inputs of the transformations and flag
+    // what they invalidate.  The transformations are recomputed once, when
+    // the text is next displayed.
+    struct TextTransform
+    {
+        GLfloat          mnZoom;		// Zooming within a viewport
+        GLfloat          mnFovy;		// Field-of-view within a viewport
+        GLuint           mnProjection;	// Projection of the mvp, a TextProjection
+        GLuint           mnDirty;		// Invalidated transformations, TextDirty flags
+        vector_float3    m_Translate;	// Model translation for perspective correct text
+        vector_float4    m_Rotate;		// Model rotation { x, y, z, θ } for perspective correct text
+        matrix_float4x4  m_ModelView;	// Model-view transformation matrix for perspective correct text
     }; // TextTransform
     
-    typedef union TextTransform  TextTransform;
+    typedef struct TextTransform  TextTransform;
     
     struct TextProgram
     {
-        GLuint        mnPID;		// Program object ID
-        GLuint        mnVAO;		// VAO id
-        TextUniforms  m_UID;		// Uniform IDs
-        ProgramRef    mpProgram;    // Program object encapsulating shaders
+        GLuint           mnPID;		// Program object ID
+        GLuint           mnVAO;		// VAO id
+        GLuint           mnFirst;		// First vertex in the VAO's buffer
+        TextUniforms     m_UID;		// Uniform IDs
+        ProgramRef       mpProgram;    // Program object encapsulating shaders
+        VertexLayoutRef  mpLayout;     // Attribute locations of the program
     }; // Program
     
     typedef struct TextProgram  TextProgram;
     
+    // Glyphs of a text in the same atlas page, drawn together
+    struct TextRange
+    {
+        GLuint  mnTID;      // Atlas page texture ID
+        GLuint  mnFirst;    // First vertex, from the text's first
+        GLuint  mnCount;    // Vertex count
+    }; // TextRange
+    
+    typedef struct TextRange  TextRange;
+    
+    // A change of the string of a text laid out on a worker thread, and
+    // committed on the thread owning the context when it is done
+    struct TextJob
+    {
+        dispatch_group_t       mpGroup;        // Left when the layout is done
+        CFStringRef            mpString;       // Copy of the string, null for an attributed string
+        CFAttributedStringRef  mpAttrString;   // Copy of the attributed string
+        CFStringRef            mpFontName;     // Font of the text, null for Helvetica
+        CGFloat                mnFontSize;
+        CTTextAlignment        mnAlignment;
+        CGFloat                mnScale;        // Screen pixels per point to rasterize for
+        GlyphAtlasRef          mpAtlas;        // Atlas of the text
+        GlyphLayoutRef         mpLayout;       // Null until laid out, or if it failed
+        String                 m_Key;          // Cache key of the string, empty for an attributed string
+    }; // TextJob
+    
+    typedef struct TextJob  TextJob;
+    
     struct Text
     {
-        GLuint			mnTID;          // Texture ID
         GLenum          mnFactor[2];    // Blend function source factor
+        bool            mbOrtho2D;      // Non-perspective text
         NSPoint         m_Position;		// Text position
         NSSize          m_Size;			// Bounding rectangle limits
         NSRect          m_Bounds;		// Text view bounds
         TextTransform   m_Transform;	// Transformations
+        TextBlock       m_Block;		// Uniform block staged for every frame
+        GLintptr        mnOffset;		// Offset of the block in the uniform arena
         TextProgram     m_Program;		// Program Object
-        VertexArrayRef  mpVertices;     // VAO encapsulation
+        GLuint          mnRanges;       // Atlas pages sampled
+        TextRange      *mpRanges;       // Vertices of each atlas page
+        GlyphAtlasRef   mpAtlas;        // Shared glyph atlas, see GLUGlyphAtlas.h
+        ArrayRef        mpArray;        // Glyph vertices, for batches
+        VertexArrayRef  mpVertices;     // Glyph quads VAO
+        String         *mpKey;          // Text cache key, null if not cached
+        CFStringRef     mpFontName;     // Font of a text created from a string, null for Helvetica
+        CGFloat         mnFontSize;     // Font size, 0 for a text created from an attributed string
+        CTTextAlignment mnAlignment;    // Alignment of a text created from a string
+        bool            mbColors;       // Corner colors given
+        GLfloat         m_Colors[16];   // Corner colors
+        GLuint          mnRevision;     // Changes of the glyph vertices, for batches
+        TextJob        *mpJob;          // String laid out on a worker thread
+        TextJob        *mpNext;         // Latest string to lay out after it
+        CFStringRef     mpString;       // Copy of the string, laid out again at a new scale
+        CFAttributedStringRef mpAttrString; // Copy of the attributed string
+        CGFloat         mnScale;        // Screen pixels per point the glyphs are rasterized for, 0 if unknown
+        GLuint          mnGeneration;   // Generation of the atlas the glyphs were laid out at
     }; // Text
     
     typedef struct Text  Text;
     
-    static const simd::float3 kDefaultEye    = {0.0f, 0.0f, 2.0f};
-    static const simd::float3 kDefaultCenter = {0.0f, 0.0f, 0.0f};
-    static const simd::float3 kDefaultUp     = {0.0f, 1.0f, 0.0f};
+    // Glyph vertices of a deleted text, kept for a text created again with
+    // the same key
+    struct TextCacheEntry
+    {
+        String          m_Key;
+        NSSize          m_Size;         // Bounding rectangle limits
+        GLuint          mnRanges;       // Atlas pages sampled
+        TextRange      *mpRanges;       // Vertices of each atlas page
+        ArrayRef        mpArray;        // Glyph vertices, for batches
+        VertexArrayRef  mpVertices;     // Glyph quads VAO
+        GlyphAtlasRef   mpAtlas;        // Reference to the atlas the vertices sample
+        CGFloat         mnScale;        // Screen pixels per point the glyphs were rasterized for
+        GLuint          mnGeneration;   // Generation of the atlas the glyphs were laid out at
+        GLsizeiptr      mnBytes;        // GPU bytes of the vertices
+    }; // TextCacheEntry
+    
+    typedef struct TextCacheEntry  TextCacheEntry;
+    
+    typedef std::list<TextCacheEntry>  TextCacheEntries;
+    
+    // Cache of the glyph vertices of deleted texts, least recently deleted
+    // last, and indexed by the hash of their keys
+    struct TextCache
+    {
+        GLsizeiptr  mnBudget;       // GPU bytes the cache may hold
+        GLsizeiptr  mnBytes;        // GPU bytes held
+        GLuint      mnHits;
+        GLuint      mnMisses;
+        GLuint      mnEvictions;
+        
+        TextCacheEntries                                     m_Entries;
+        std::unordered_map<String, TextCacheEntries::iterator>  m_Index;
+    }; // TextCache
+    
+    typedef struct TextCache  TextCache;
+    
+    // 4 MB of vertices per share group, some 200 thousand glyphs
+    static GLsizeiptr gTextCacheBudget = 4 << 20;
+    
+    // Cache of each share group, whose buffers and atlas its vertices use.
+    // Vaos are not shared between contexts, so a cached text keeps no vao,
+    // and the text that takes its vertices back creates one.
+    static std::unordered_map<CGLShareGroupObj, TextCache> gTextCaches;
+    
+    // Uniform arena holding the transforms of every text object of a share
+    // group for the current frame.  Created with the first text of the share
+    // group and deleted with the last.
+    struct TextArena
+    {
+        CGLShareGroupObj  mpShareGroup;
+        UniformArenaRef   mpArena;
+        GLuint            mnCount;
+    }; // TextArena
+    
+    typedef struct TextArena  TextArena;
+    
+    // Arenas of every share group, one for most applications
+    static std::vector<TextArena> gTextArenas;
+    
+    // Texts of a batch are limited by the size of its uniform block, an
+    // array of their transformations
+    static const GLuint kTextBatchCapacity = 64;
+    
+    // Contents of the std140 "Transforms" uniform block of the batch
+    // program, the model-view-projection of each text of the batch.
+    // Non-perspective texts fold their orthographic 2D transformation into
+    // a matrix.
+    struct TextBatchBlock
+    {
+        matrix_float4x4  m_MVP[kTextBatchCapacity];
+    }; // TextBatchBlock
+    
+    typedef struct TextBatchBlock  TextBatchBlock;
+    
+    static_assert(sizeof(TextBatchBlock) == 4096, "TextBatchBlock must match the std140 layout of the batch Transforms block");
+    
+    // A text of a batch, and the blending factors and the revision of the
+    // glyphs the batch was built with
+    struct TextBatchSlot
+    {
+        TextRef  mpText;
+        GLenum   mnFactor[2];
+        GLuint   mnRevision;
+    }; // TextBatchSlot
+    
+    typedef struct TextBatchSlot  TextBatchSlot;
+    
+    // Consecutive vertices of a batch drawn with the same blending factors
+    // and atlas page
+    struct TextBatchDraw
+    {
+        GLenum  mnFactor[2];    // Blend function factors
+        GLuint  mnTID;          // Atlas page texture ID
+        GLuint  mnFirst;        // First vertex, from the batch's first
+        GLuint  mnCount;        // Vertex count
+    }; // TextBatchDraw
+    
+    typedef struct TextBatchDraw  TextBatchDraw;
+    
+    struct TextBatch
+    {
+        bool                        mbDirty;        // Vertices must be rebuilt
+        GLuint                      mnPID;          // Program object ID
+        GLuint                      mnVAO;          // VAO id
+        GLuint                      mnFirst;        // First vertex in the VAO's buffer
+        ProgramRef                  mpProgram;      // Program object shared by the texts
+        VertexLayoutRef             mpLayout;       // Attribute locations of the program
+        VertexArrayRef              mpVertices;     // Glyph vertices of every text
+        std::vector<TextBatchSlot>  m_Slots;        // Texts, indexed by their vertices
+        std::vector<TextBatchDraw>  m_Draws;        // Draws, sorted by blending and page
+    }; // TextBatch
+    
+    typedef struct TextBatch  TextBatch;
+    
+    static const GLuint         kTextBlockBinding = 0;
+    static const GLchar * const kTextBlockName    = "Transforms";
+    
+    // Fragment shader of every text program.  Atlas texels hold the signed
+    // distance to the glyph outline, 0.5 on it, and coverage ramps across
+    // the outline over the width of a screen pixel, crisp at any zoom.
+    static const GLchar * const kTextFragmentShader =
+        "#version 150\n"
+        "uniform sampler2D tex;\n"
+        "in block\n"
+        "{\n"
+        "    vec2 texCoords;\n"
+        "    vec4 colors;\n"
+        "} inData;\n"
+        "out vec4 fragColor;\n"
+        "void main()\n"
+        "{\n"
+        "    float distance = texture(tex, inData.texCoords).r;\n"
+        "    float width    = max(0.5 * fwidth(distance), 1.0e-5);\n"
+        "    float coverage = smoothstep(0.5 - width, 0.5 + width, distance);\n"
+        "    fragColor = coverage * inData.colors;\n"
+        "}\n";
+    
+    // Glyph vertices in float positions and texture coordinates, and byte
+    // colors, 20 bytes rather than 32.  Half-floats would misplace atlas
+    // texture coordinates by up to half a texel.
+    static const VertexType kTextVertexTypes[] =
+    {
+        kVertexTypeFloat,
+        kVertexTypeFloat,
+        kVertexTypeFloat,
+        kVertexTypeUNorm8
+    };
+    
+    static constexpr GLM::Vec3 kDefaultEye    = {{0.0f, 0.0f, 2.0f}};
+    static constexpr GLM::Vec3 kDefaultCenter = {{0.0f, 0.0f, 0.0f}};
+    static constexpr GLM::Vec3 kDefaultUp     = {{0.0f, 1.0f, 0.0f}};
     
-    // Default model-view look at perspective linear transformation
-    static const simd::float4x4 kDefaultModelView = GLM::lookAt(GLU::kDefaultEye, GLU::kDefaultCenter, GLU::kDefaultUp);
+    // Default model-view look at perspective linear transformation, folded at
+    // compile time and transposed to match the simd transforms convention
+    static constexpr GLM::Mat4 kDefaultModelView = GLM::transpose(GLM::lookAt(GLU::kDefaultEye, GLU::kDefaultCenter, GLU::kDefaultUp));
 } // GLU
 
 #pragma mark -
-#pragma mark Private - Utilities - Texture
+#pragma mark Private - Utilities - Layout
 
-// Generate texture from context's bitmap
-static bool GLUTextCreateTexture2D(const GLchar * const pString,
-                                   const GLchar * const pFontName,
-                                   const CGFloat& rFontSize,
-                                   const CTTextAlignment& rAlignment,
-                                   GLU::TextRef pText)
+// Lay out an attributed string into glyph quads of the shared atlas
+static bool GLUTextLayout(CFAttributedStringRef pAttrString,
+                          GLU::GlyphQuads& rQuads,
+                          GLU::TextRef pText)
 {
-    CGFloat color[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    pText->mpAtlas = GLU::GlyphAtlasAcquire();
     
-    pText->mnTID = GLU::Texture2DCreateFromString(pString,
-                                                  pFontName,
-                                                  rFontSize,
-                                                  rAlignment,
-                                                  color,
-                                                  pText->m_Size);
+    bool bSuccess = GLU::GlyphAtlasLayout(pAttrString, pText->m_Size, rQuads, pText->mnScale, pText->mpAtlas);
+    
+    if(!bSuccess)
+    {
+        GLU::GlyphAtlasRelease(pText->mpAtlas);
+        
+        pText->mpAtlas = nullptr;
+    } // if
     
-    return bool(pText->mnTID);
-} // GLUTextCreateTexture2D
+    return bSuccess;
+} // GLUTextLayout
 
-// Generate texture from context's bitmap
-static bool GLUTextCreateTexture2D(const GLU::String& rString,
-                                   const GLU::String& rFontName,
-                                   const CGFloat& rFontSize,
-                                   const CTTextAlignment& rAlignment,
-                                   GLU::TextRef pText)
+// Lay out a core foundation string into glyph quads of the shared atlas
+static bool GLUTextLayout(CFStringRef pString,
+                          CFStringRef pFontName,
+                          const CGFloat& rFontSize,
+                          const CTTextAlignment& rAlignment,
+                          GLU::GlyphQuads& rQuads,
+                          GLU::TextRef pText)
+{
+    pText->mpAtlas = GLU::GlyphAtlasAcquire();
+    
+    bool bSuccess = GLU::GlyphAtlasLayout(pString,
+                                          pFontName,
+                                          rFontSize,
+                                          rAlignment,
+                                          pText->m_Size,
+                                          rQuads,
+                                          pText->mnScale,
+                                          pText->mpAtlas);
+    
+    if(!bSuccess)
+    {
+        GLU::GlyphAtlasRelease(pText->mpAtlas);
+        
+        pText->mpAtlas = nullptr;
+    } // if
+    
+    return bSuccess;
+} // GLUTextLayout
+
+// Lay out a stl string into glyph quads of the shared atlas
+static bool GLUTextLayout(const GLU::String& rString,
+                          const GLU::String& rFontName,
+                          const CGFloat& rFontSize,
+                          const CTTextAlignment& rAlignment,
+                          GLU::GlyphQuads& rQuads,
+                          GLU::TextRef pText)
 {
-    CGFloat color[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    bool bSuccess = false;
+    
+    CFStringRef pString = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                    rString.c_str(),
+                                                    kCFStringEncodingUTF8);
     
-    pText->mnTID = GLU::Texture2DCreateFromString(rString,
-                                                  rFontName,
-                                                  rFontSize,
-                                                  rAlignment,
-                                                  color,
-                                                  pText->m_Size);
+    if(pString != nullptr)
+    {
+        CFStringRef pFontName = rFontName.empty() ? nullptr : CFStringCreateWithCString(kCFAllocatorDefault,
+                                                                                        rFontName.c_str(),
+                                                                                        kCFStringEncodingUTF8);
+        
+        bSuccess = GLUTextLayout(pString, pFontName, rFontSize, rAlignment, rQuads, pText);
+        
+        if(pFontName != nullptr)
+        {
+            CFRelease(pFontName);
+        } // if
+        
+        CFRelease(pString);
+    } // if
     
-    return bool(pText->mnTID);
-} // GLUTextCreateTexture2D
+    return bSuccess;
+} // GLUTextLayout
 
-// Generate texture from context's bitmap
-static bool GLUTextCreateTexture2D(CFStringRef pString,
-                                   CFStringRef pFontName,
-                                   const CGFloat& rFontSize,
-                                   const CTTextAlignment& rAlignment,
-                                   GLU::TextRef pText)
+// Keep the font, size and alignment of a text created from a string
+static void GLUTextSetFont(CFStringRef pFontName,
+                           const CGFloat& rFontSize,
+                           const CTTextAlignment& rAlignment,
+                           GLU::TextRef pText)
+{
+    pText->mpFontName  = (pFontName != nullptr) ? CFStringRef(CFRetain(pFontName)) : nullptr;
+    pText->mnFontSize  = rFontSize;
+    pText->mnAlignment = rAlignment;
+} // GLUTextSetFont
+
+// Keep the font, size and alignment of a text created from a stl string
+static void GLUTextSetFont(const GLU::String& rFontName,
+                           const CGFloat& rFontSize,
+                           const CTTextAlignment& rAlignment,
+                           GLU::TextRef pText)
 {
-    CGFloat color[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    CFStringRef pFontName = rFontName.empty() ? nullptr : CFStringCreateWithCString(kCFAllocatorDefault,
+                                                                                    rFontName.c_str(),
+                                                                                    kCFStringEncodingUTF8);
     
-    pText->mnTID = GLU::Texture2DCreateFromString(pString,
-                                                  pFontName,
-                                                  rFontSize,
-                                                  rAlignment,
-                                                  color,
-                                                  pText->m_Size);
+    GLUTextSetFont(pFontName, rFontSize, rAlignment, pText);
     
-    return bool(pText->mnTID);
-} // GLUTextCreateTexture2D
+    if(pFontName != nullptr)
+    {
+        CFRelease(pFontName);
+    } // if
+} // GLUTextSetFont
 
-// Generate texture from context's bitmap
-static bool GLUTextCreateTexture2D(CFAttributedStringRef pAttrString,
-                                   GLU::TextRef pText)
+// Keep a copy of the string of a text, re-laid out when its footprint on
+// screen changes resolution
+static void GLUTextSetSource(CFStringRef pString,
+                             CFAttributedStringRef pAttrString,
+                             GLU::TextRef pText)
+{
+    if(pText->mpString != nullptr)
+    {
+        CFRelease(pText->mpString);
+    } // if
+    
+    if(pText->mpAttrString != nullptr)
+    {
+        CFRelease(pText->mpAttrString);
+    } // if
+    
+    pText->mpString     = (pString != nullptr) ? CFStringCreateCopy(kCFAllocatorDefault, pString) : nullptr;
+    pText->mpAttrString = (pAttrString != nullptr) ? CFAttributedStringCreateCopy(kCFAllocatorDefault, pAttrString) : nullptr;
+} // GLUTextSetSource
+
+// Keep a copy of the stl string of a text
+static void GLUTextSetSource(const GLU::String& rString,
+                             GLU::TextRef pText)
 {
-    CFRange range = CFRangeMake(0, CFAttributedStringGetLength(pAttrString));
+    CFStringRef pString = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                    rString.c_str(),
+                                                    kCFStringEncodingUTF8);
     
-    pText->mnTID = GLU::Texture2DCreateFromString(pAttrString,
-                                                  range,
-                                                  pText->m_Size);
+    GLUTextSetSource(pString, nullptr, pText);
     
-    return bool(pText->mnTID);
-} // GLUTextCreateTexture2D
+    if(pString != nullptr)
+    {
+        CFRelease(pString);
+    } // if
+} // GLUTextSetSource
 
 #pragma mark -
-#pragma mark Private - Utilities - Quad
+#pragma mark Private - Utilities - Vertices
 
-// Create a quad for perspective text
-static void GLUTextQuadCreatePerspective(const GLchar * const pVertex,
-                                         const GLchar * const pColor,
-                                         const GLfloat * const pColors,
-                                         const GLchar * const pTexCoords,
-                                         GLU::TextRef pText)
+// Interpolate the corner colors of the text at a point of its frame, in
+// [0, 1], and modulate them by the color of the glyph's run
+static void GLUTextGetColor(const GLfloat * const pColors,
+                            const GLfloat& rU,
+                            const GLfloat& rV,
+                            const GLfloat * const pRunColor,
+                            GLfloat * const pColor)
+{
+    for(GLuint i = 0; i < 4; ++i)
+    {
+        GLfloat nColor = 1.0f;
+        
+        if(pColors != nullptr)
+        {
+            const GLfloat nBottom = pColors[i]      + rU * (pColors[4  + i] - pColors[i]);
+            const GLfloat nTop    = pColors[12 + i] + rU * (pColors[8  + i] - pColors[12 + i]);
+            
+            nColor = nBottom + rV * (nTop - nBottom);
+        } // if
+        
+        pColor[i] = nColor * pRunColor[i];
+    } // for
+} // GLUTextGetColor
+
+// Create the vertices of the glyph quads, two triangles each, grouped by
+// atlas page, and a range for every page.  Positions span a frame of the
+// text's size scaled by rScale and offset by rOffset, as the quad of a
+// whole-string texture did.
+static bool GLUTextCreateArray(const GLU::GlyphQuads& rQuads,
+                               const GLfloat * const pColors,
+                               const GLfloat& rScale,
+                               const GLfloat& rOffset,
+                               const NSSize& rSize,
+                               const GLU::GlyphAtlasRef pAtlas,
+                               GLuint& rRanges,
+                               GLU::TextRange *&rpRanges,
+                               GLU::ArrayRef& rpArray)
 {
-    pText->mpVertices = GLU::VertexArrayCreateQuad(pText->m_Program.mnPID,
-                                                   pVertex,
-                                                   pColor,
-                                                   pColors,
-                                                   pTexCoords);
+    rRanges  = 0;
+    rpRanges = nullptr;
+    rpArray  = nullptr;
     
-    if(pText->mpVertices != nullptr)
+    if(rQuads.empty())
+    {
+        return true;
+    } // if
+    
+    // Corners of a quad, counter-clockwise from the bottom-left
+    const GLuint kCorners[6][2] = {{0, 0}, {1, 0}, {1, 1}, {1, 1}, {0, 1}, {0, 0}};
+    
+    const GLuint nCount = GLuint(6 * rQuads.size());
+    
+    const GLfloat nWidth  = GLfloat(rSize.width);
+    const GLfloat nHeight = GLfloat(rSize.height);
+    
+    try
+    {
+        std::vector<GLuint> order(rQuads.size());
+        
+        for(GLuint i = 0; i < order.size(); ++i)
+        {
+            order[i] = i;
+        } // for
+        
+        std::stable_sort(order.begin(), order.end(), [&rQuads](const GLuint& a, const GLuint& b) {
+            return rQuads[a].mnPage < rQuads[b].mnPage;
+        });
+        
+        std::vector<GLfloat> positions(2 * nCount);
+        std::vector<GLfloat> texCoords(2 * nCount);
+        std::vector<GLfloat> colors(4 * nCount);
+        
+        GLfloat *pPosition = positions.data();
+        GLfloat *pTexCoord = texCoords.data();
+        GLfloat *pColor    = colors.data();
+        
+        for(const GLuint& rIndex : order)
+        {
+            const GLU::GlyphQuad& rQuad = rQuads[rIndex];
+            
+            const GLfloat x[2] = {GLfloat(CGRectGetMinX(rQuad.m_Bounds)), GLfloat(CGRectGetMaxX(rQuad.m_Bounds))};
+            const GLfloat y[2] = {GLfloat(CGRectGetMinY(rQuad.m_Bounds)), GLfloat(CGRectGetMaxY(rQuad.m_Bounds))};
+            
+            for(const GLuint (&rCorner)[2] : kCorners)
+            {
+                const GLfloat u = x[rCorner[0]] / nWidth;
+                const GLfloat v = y[rCorner[1]] / nHeight;
+                
+                pPosition[0] = rScale * u + rOffset;
+                pPosition[1] = rScale * v + rOffset;
+                
+                pTexCoord[0] = rQuad.m_TexCoords[2 * rCorner[0]];
+                pTexCoord[1] = rQuad.m_TexCoords[2 * rCorner[1] + 1];
+                
+                GLUTextGetColor(pColors, u, v, rQuad.m_Color, pColor);
+                
+                pPosition += 2;
+                pTexCoord += 2;
+                pColor    += 4;
+            } // for
+        } // for
+        
+        // A range for every atlas page sampled
+        rpRanges = new GLU::TextRange[GLU::GlyphAtlasGetPageCount(pAtlas)];
+        
+        for(GLuint i = 0; i < order.size(); ++i)
+        {
+            const GLuint nPage = rQuads[order[i]].mnPage;
+            
+            if(!i || (nPage != rQuads[order[i - 1]].mnPage))
+            {
+                GLU::TextRange& rRange = rpRanges[rRanges++];
+                
+                rRange.mnTID   = GLU::GlyphAtlasGetTexture(nPage, pAtlas);
+                rRange.mnFirst = 6 * i;
+                rRange.mnCount = 0;
+            } // if
+            
+            rpRanges[rRanges - 1].mnCount += 6;
+        } // for
+        
+        rpArray = GLU::ArrayCreate(nCount,
+                                   positions.data(),
+                                   texCoords.data(),
+                                   colors.data());
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for glyph vertices: \"%s\"", ba.what());
+    } // catch
+    
+    if(rpArray == nullptr)
     {
-        pText->m_Program.mnVAO = GLU::VertexArrayGetVAO(pText->mpVertices);
+        delete [] rpRanges;
+        
+        rRanges  = 0;
+        rpRanges = nullptr;
+        
+        return false;
     } // if
-} // GLUTextQuadCreatePerspective
+    
+    return true;
+} // GLUTextCreateArray
 
-// Create a quad for non-perspective text
-static void GLUTextQuadCreateNonPerspective(const GLchar * const pColor,
-                                            const GLfloat * const pColors,
-                                            const GLchar * const pTexCoords,
-                                            GLU::TextRef pText)
+// Create the vertices of the glyph quads, and their vao
+static bool GLUTextCreateVertices(const GLU::GlyphQuads& rQuads,
+                                  const GLfloat * const pColors,
+                                  const GLfloat& rScale,
+                                  const GLfloat& rOffset,
+                                  GLU::TextRef pText)
 {
-    pText->mpVertices = GLU::VertexArrayCreateQuad(pText->m_Program.mnPID,
-                                                   pColor,
-                                                   pColors,
-                                                   pTexCoords);
+    // Kept for changing the string, see TextSetString
+    pText->mbColors = pColors != nullptr;
     
+    if(pColors != nullptr)
+    {
+        std::memcpy(pText->m_Colors, pColors, sizeof(pText->m_Colors));
+    } // if
+    
+    // Vertices of a deleted text, taken from the cache, with a vao of the
+    // current context
     if(pText->mpVertices != nullptr)
     {
-        pText->m_Program.mnVAO = GLU::VertexArrayGetVAO(pText->mpVertices);
+        if(!GLU::VertexArrayAttach(pText->m_Program.mpLayout, pText->mpVertices))
+        {
+            return false;
+        } // if
+        
+        pText->m_Program.mnVAO   = GLU::VertexArrayGetVAO(pText->mpVertices);
+        pText->m_Program.mnFirst = GLU::VertexArrayGetFirst(pText->mpVertices);
+        
+        return true;
+    } // if
+    
+    pText->mnGeneration = GLU::GlyphAtlasGetGeneration(pText->mpAtlas);
+    
+    // Kept for the batches the text is added to, and for finding the
+    // vertices a new string changes
+    if(!GLUTextCreateArray(rQuads,
+                           pColors,
+                           rScale,
+                           rOffset,
+                           pText->m_Size,
+                           pText->mpAtlas,
+                           pText->mnRanges,
+                           pText->mpRanges,
+                           pText->mpArray))
+    {
+        return false;
+    } // if
+    
+    if(pText->mpArray == nullptr)
+    {
+        return true;
+    } // if
+    
+    pText->mpVertices = GLU::VertexArrayCreate(pText->m_Program.mpLayout,
+                                               GLU::ArrayGetCount(pText->mpArray),
+                                               pText->mpArray);
+    
+    if(pText->mpVertices == nullptr)
+    {
+        GLU::ArrayDelete(pText->mpArray);
+        
+        delete [] pText->mpRanges;
+        
+        pText->mnRanges = 0;
+        pText->mpRanges = nullptr;
+        pText->mpArray  = nullptr;
+        
+        return false;
     } // if
-} // GLUTextQuadCreateNonPerspective
+    
+    pText->m_Program.mnVAO   = GLU::VertexArrayGetVAO(pText->mpVertices);
+    pText->m_Program.mnFirst = GLU::VertexArrayGetFirst(pText->mpVertices);
+    
+    return true;
+} // GLUTextCreateVertices
+
+// Create the glyph vertices of a perspective text, in [-1, 1]
+static bool GLUTextVerticesCreatePerspective(const GLchar * const pVertex,
+                                             const GLchar * const pColor,
+                                             const GLfloat * const pColors,
+                                             const GLchar * const pTexCoords,
+                                             const GLU::GlyphQuads& rQuads,
+                                             GLU::TextRef pText)
+{
+    pText->m_Program.mpLayout = GLU::VertexLayoutCreate(pText->m_Program.mnPID,
+                                                        GLU::kArrayLayout2D,
+                                                        pVertex,
+                                                        nullptr,
+                                                        pTexCoords,
+                                                        pColor,
+                                                        GLU::kTextVertexTypes);
+    
+    return GLUTextCreateVertices(rQuads, pColors, 2.0f, -1.0f, pText);
+} // GLUTextVerticesCreatePerspective
+
+// Create the glyph vertices of a non-perspective text, in [0, 1]
+static bool GLUTextVerticesCreateNonPerspective(const GLchar * const pVertex,
+                                                const GLchar * const pColor,
+                                                const GLfloat * const pColors,
+                                                const GLchar * const pTexCoords,
+                                                const GLU::GlyphQuads& rQuads,
+                                                GLU::TextRef pText)
+{
+    pText->m_Program.mpLayout = GLU::VertexLayoutCreate(pText->m_Program.mnPID,
+                                                        GLU::kArrayLayout2D,
+                                                        pVertex,
+                                                        nullptr,
+                                                        pTexCoords,
+                                                        pColor,
+                                                        GLU::kTextVertexTypes);
+    
+    return GLUTextCreateVertices(rQuads, pColors, 1.0f, 0.0f, pText);
+} // GLUTextVerticesCreateNonPerspective
 
 #pragma mark -
 #pragma mark Private - Utilities - Bounds
 
-// Set the text view bounds
+// Set the text view bounds, returns true if they changed
 static bool GLUTextSetBounds(const NSRect &rBounds,
                              GLU::TextRef pText)
 {
+    bool bChanged = !NSEqualRects(rBounds, pText->m_Bounds);
+    
     pText->m_Bounds = rBounds;
     
-    return !NSEqualRects(rBounds, pText->m_Bounds);
+    return bChanged;
 } // GLUTextSetBounds
 
 #pragma mark -
 #pragma mark Private - Utilities - Transformations
 
+// Flag transformations to be recomputed when the text is next displayed
+static void GLUTextTransformInvalidate(const GLuint& rDirty,
+                                       GLU::TextRef pText)
+{
+    pText->m_Transform.mnDirty |= rDirty;
+} // GLUTextTransformInvalidate
+
 // Calculate the orthographic 2D linear transformation
-static vector_float4 GLUTextTransformCreateOrtho2D(const NSRect& rBounds,
-                                                   GLU::TextRef pText)
+static vector_float4 GLUTextTransformCreateOrtho2D(const GLU::TextRef pText)
 {
-    // Set the text-view bounds
-    GLUTextSetBounds(rBounds, pText);
-    
     // Compute the orthographic 2D linear transformation
     GLfloat x = 2.0f / pText->m_Bounds.size.width;
     GLfloat y = 2.0f / pText->m_Bounds.size.height;
@@ -274,15 +816,41 @@ static vector_float4 GLUTextTransformCreateOrtho2D(const NSRect& rBounds,
     return v;
 } // GLUTextTransformCreateOrtho2D
 
-// Compute a linear transformation with a frustum
-static matrix_float4x4 GLUTextTransformCreateMVP(const NSRect& rBounds,
-                                                 GLU::TextRef pText)
+// Compute the model-view linear transformation
+static matrix_float4x4 GLUTextTransformCreateModelView(const GLU::TextRef pText)
 {
-    // Set the text-view bounds
-    GLUTextSetBounds(rBounds, pText);
+    // Compute the aspect ratio
+    GLfloat nAspect = GLfloat(pText->m_Bounds.size.width  / pText->m_Bounds.size.height);
+    GLfloat nFactor = 1.0f / nAspect;
+    
+    // Scale
+    simd::float3 scale = 0.0f;
+    
+    scale.x = nFactor * pText->m_Size.width / pText->m_Size.height;
+    scale.y = nFactor;
+    scale.z = nFactor;
+    
+    // Compute the model-view linear transformation
+    simd::float4x4 modelView = GLM::scale(scale) * GLM::cast<simd::float4x4>(GLU::kDefaultModelView);
     
-    // For computing the mvp linear transformation
-    GLfloat nAspect =  GLfloat(pText->m_Bounds.size.width / pText->m_Bounds.size.height);
+    modelView = GLM::rotate(pText->m_Transform.m_Rotate) * modelView;
+    modelView = GLM::translate(pText->m_Transform.m_Translate) * modelView;
+    
+    return modelView;
+} // GLUTextTransformCreateModelView
+
+// Compute the projection linear transformation, either a frustum or a
+// prespective projection
+static matrix_float4x4 GLUTextTransformCreateProjection(const GLU::TextRef pText)
+{
+    GLfloat nAspect = GLfloat(pText->m_Bounds.size.width / pText->m_Bounds.size.height);
+    
+    if(pText->m_Transform.mnProjection == GLU::kTextProjectionPerspective)
+    {
+        return GLM::perspective(pText->m_Transform.mnFovy, nAspect, 1.0f, 100.0f);
+    } // if
+    
+    // For computing the frustum
     GLfloat nRight  =  pText->m_Transform.mnZoom;
     GLfloat nLeft   = -nRight;
     GLfloat nTop    =  pText->m_Transform.mnZoom;
@@ -300,93 +868,135 @@ static matrix_float4x4 GLUTextTransformCreateMVP(const NSRect& rBounds,
         nRight *= nAspect;
     } // else
     
-    // compute the projection linear transformation
-    simd::float4x4 projection = GLM::frustum(nLeft, nRight, nBottom, nTop, 1.0f, 100.0f);
-    
-    // Create a MVP linear transformation using a frustum
-    return pText->m_Transform.m_ModelView * projection;
-} // GLUTextTransformCreateMVP
+    return GLM::frustum(nLeft, nRight, nBottom, nTop, 1.0f, 100.0f);
+} // GLUTextTransformCreateProjection
 
-// Compute the model-view-projection linear transformation
-static matrix_float4x4 GLUTextTransformCreateMVP(const NSRect& rBounds,
-                                                 const vector_float3& rTranslate,
-                                                 const vector_float4& rRotate,
-                                                 GLU::TextRef pText)
+// Recompute the invalidated transformations, and stage them in the
+// uniform block
+static void GLUTextTransformUpdate(GLU::TextRef pText)
 {
-    // Set the text-view bounds
-    GLUTextSetBounds(rBounds, pText);
-    
-    // Compute the aspect ratio
-    GLfloat nAspect = GLfloat(pText->m_Bounds.size.width  / pText->m_Bounds.size.height);
-    GLfloat nFactor = 1.0f / nAspect;
-    
-    // Scale
-    simd::float3 scale = 0.0f;
+    const GLuint nDirty = pText->m_Transform.mnDirty;
     
-    scale.x = nFactor * pText->m_Size.width / pText->m_Size.height;
-    scale.y = nFactor;
-    scale.z = nFactor;
+    if(nDirty & GLU::kTextDirtyModelView)
+    {
+        pText->m_Transform.m_ModelView = GLUTextTransformCreateModelView(pText);
+    } // if
     
-    // Compute the model-view linear transformation
-    simd::float4x4 modelView = GLM::scale(scale) * GLU::kDefaultModelView;
+    if(nDirty & (GLU::kTextDirtyModelView | GLU::kTextDirtyProjection))
+    {
+        // Create a MVP linear transformation
+        pText->m_Block.m_MVP = pText->m_Transform.m_ModelView * GLUTextTransformCreateProjection(pText);
+    } // if
     
-    modelView = GLM::rotate(rRotate) * modelView;
-    modelView = GLM::translate(rTranslate) * modelView;
+    if(nDirty & GLU::kTextDirtyOrtho2D)
+    {
+        pText->m_Block.m_Ortho2D = GLUTextTransformCreateOrtho2D(pText);
+    } // if
     
-    // Set the model-view matrix
-    pText->m_Transform.m_ModelView = modelView;
+    pText->m_Transform.mnDirty = 0;
+} // GLUTextTransformUpdate
+
+// Set the inputs of the model-view-projection linear transformation with a
+// prespective projection
+static void GLUTextTransformSetMVP(const NSRect& rBounds,
+                                   const vector_float3& rTranslate,
+                                   const vector_float4& rRotate,
+                                   GLU::TextRef pText)
+{
+    GLUTextSetBounds(rBounds, pText);
     
-    // Compute the prespective projection transformation
-    simd::float4x4 perspective = GLM::perspective(pText->m_Transform.mnFovy, nAspect, 1.0f, 100.0f);
+    pText->m_Transform.m_Translate  = rTranslate;
+    pText->m_Transform.m_Rotate     = rRotate;
+    pText->m_Transform.mnProjection = GLU::kTextProjectionPerspective;
     
-    // Compute a linear transformation with a prespective projection
-    return pText->m_Transform.m_ModelView * perspective;
-} // GLUTextTransformCreateMVP
+    GLUTextTransformInvalidate(GLU::kTextDirtyModelView | GLU::kTextDirtyProjection, pText);
+} // GLUTextTransformSetMVP
 
 #pragma mark -
 #pragma mark Private - Utilities - Uniforms
 
-// Enable the uniform assocated with a model-view-projection linear transformation
-static void GLUTextUniformEnableMVP(const GLchar * pName,
-                                    const NSRect& rBounds,
-                                    const vector_float3& rTranslate,
-                                    const vector_float4& rRotate,
-                                    GLU::TextRef pText)
+// The arena of the share group of the current context, null if it has none
+static GLU::TextArena *GLUTextArenaFind()
 {
-    // Compute the model-view-projection linear transformation
-    matrix_float4x4 mvp = GLUTextTransformCreateMVP(rBounds, rTranslate, rRotate, pText);
+    CGLShareGroupObj pShareGroup = CGLGetShareGroup(CGLGetCurrentContext());
     
-    // Enable the program object
-    glUseProgram(pText->m_Program.mnPID);
+    for(GLU::TextArena& rArena : GLU::gTextArenas)
+    {
+        if(rArena.mpShareGroup == pShareGroup)
+        {
+            return &rArena;
+        } // if
+    } // for
     
-    // Cache the uniform location
-    pText->m_Program.m_UID.mnMVP = glGetUniformLocation(pText->m_Program.mnPID, pName);
+    return nullptr;
+} // GLUTextArenaFind
+
+// Delete an arena and its uniform buffer
+static void GLUTextArenaDelete(GLU::TextArena *pArena)
+{
+    GLU::UniformArenaDelete(pArena->mpArena);
     
-    // Update the mvp linear transformation
-    GLM::uniform(pText->m_Program.m_UID.mnMVP, false, mvp);
-} // GLUTextUniformEnableMVP
+    GLU::gTextArenas.erase(GLU::gTextArenas.begin() + (pArena - GLU::gTextArenas.data()));
+} // GLUTextArenaDelete
 
-// Enable the uniform assocated with a orthographic 2D transformation
-static void GLUTextUniformEnableOrtho2D(const GLchar * const pName,
-                                        const NSRect& rBounds,
-                                        GLU::TextRef pText)
+// Source the transforms uniform block of a program from the arena of the
+// share group of the current context
+static bool GLUTextUniformEnableTransforms(const GLuint& rProgramID)
 {
-    // Calculate the orthographic 2D linear transformation
-    pText->m_Transform.m_Ortho2D = GLUTextTransformCreateOrtho2D(rBounds, pText);
+    GLU::TextArena *pArena = GLUTextArenaFind();
     
-    // Enable the program object
-    glUseProgram(pText->m_Program.mnPID);
+    if(pArena == nullptr)
+    {
+        try
+        {
+            GLU::gTextArenas.push_back({CGLGetShareGroup(CGLGetCurrentContext()), nullptr, 0});
+        } // try
+        catch(std::bad_alloc& ba)
+        {
+            NSLog(@">> ERROR: Failed allocating memory for a text arena: \"%s\"", ba.what());
+            
+            return false;
+        } // catch
+        
+        pArena = &GLU::gTextArenas.back();
+        
+        pArena->mpArena = GLU::UniformArenaCreate(GLU::kTextBlockBinding, 64 * sizeof(GLU::TextBlock));
+    } // if
+    
+    bool bSuccess = GLU::UniformArenaAttach(rProgramID,
+                                            GLU::kTextBlockName,
+                                            pArena->mpArena);
+    
+    if(bSuccess)
+    {
+        pArena->mnCount++;
+    } // if
+    else if(!pArena->mnCount)
+    {
+        GLUTextArenaDelete(pArena);
+    } // else if
+    
+    return bSuccess;
+} // GLUTextUniformEnableTransforms
+
+// Release the arena of the current share group once its last text is gone
+static void GLUTextUniformDisableTransforms()
+{
+    GLU::TextArena *pArena = GLUTextArenaFind();
     
-    // Cache the uniform location
-    pText->m_Program.m_UID.mnMVP = glGetUniformLocation(pText->m_Program.mnPID, pName);
+    if((pArena != nullptr) && pArena->mnCount && !--pArena->mnCount)
+    {
+        GLUTextArenaDelete(pArena);
+    } // if
+} // GLUTextUniformDisableTransforms
+
+// The uniform arena of the share group of the current context
+static GLU::UniformArenaRef GLUTextUniformGetArena()
+{
+    GLU::TextArena *pArena = GLUTextArenaFind();
     
-    // Set the orthographic 2D linear transformation
-    glUniform4f(pText->m_Program.m_UID.mnMVP,
-                pText->m_Transform.m_Ortho2D.x,
-                pText->m_Transform.m_Ortho2D.y,
-                pText->m_Transform.m_Ortho2D.z,
-                pText->m_Transform.m_Ortho2D.w);
-} // GLUTextUniformEnableOrtho2D
+    return (pArena != nullptr) ? pArena->mpArena : nullptr;
+} // GLUTextUniformGetArena
 
 // Enable the sampler 2D uniform assocated with a texture
 static void GLUTextUniformEnableSampler2D(const GLchar * const pName,
@@ -403,356 +1013,1660 @@ static void GLUTextUniformEnableSampler2D(const GLchar * const pName,
 } // GLUTextUniformEnableSampler2D
 
 #pragma mark -
-#pragma mark Private - Utilities - Defaults
+#pragma mark Private - Utilities - Strings
 
-static void GLUTextSetDefaults(GLU::TextRef pText)
+// Find the vertices that differ between two arrays of the same count, as
+// the range from rFirst to before rEnd.  Returns false if none does.
+static bool GLUTextCompareVertices(const GLU::ArrayRef pArrayA,
+                                   const GLU::ArrayRef pArrayB,
+                                   GLuint& rFirst,
+                                   GLuint& rEnd)
 {
-    // Clear the sturcture
-    std::memset(pText, 0x0, sizeof(GLU::Text));
+    const GLU::ArrayAttribute kAttributes[3] = {GLU::kArrayPositions, GLU::kArrayTexCoords, GLU::kArrayColors};
     
-    // Blend function source factor
-    pText->mnFactor[0] = GL_SRC_ALPHA;
+    const GLuint nCount = GLU::ArrayGetCount(pArrayA);
     
-    // Blend function destination factor
-    pText->mnFactor[1] = GL_ONE;
-} // GLUTextSetDefaults
-
-#pragma mark -
-#pragma mark Private - Utilities - Acquire
-
-static bool GLUTextAcquirePerspectiveProgram(GLU::TextRef pText)
-{
-    // Default vertex and fragment shaders
-    const GLchar *kShaders[2] =
+    rFirst = nCount;
+    rEnd   = 0;
+    
+    for(const GLU::ArrayAttribute& rAttribute : kAttributes)
     {
-        // Vertex shader
-        "#version 150\n"
-        "uniform mat4 mvp;\n"
-        "in vec2 position;\n"
-        "in vec2 texCoords;\n"
-        "in vec4 colors;\n"
-        "out block\n"
-        "{\n"
-        "    vec2 texCoords;\n"
-        "    vec4 colors;\n"
-        "} outData;\n"
-        "void main()\n"
-        "{\n"
-        "   outData.colors    = colors;\n"
-        "	outData.texCoords = texCoords;\n"
-        "	gl_Position = mvp * vec4(position,0.0,1.0);\n"
-        "}\n",
+        const GLU::ArraySpan spanA = GLU::ArrayGetSpan(rAttribute, pArrayA);
+        const GLU::ArraySpan spanB = GLU::ArrayGetSpan(rAttribute, pArrayB);
         
-        // Fragment shader
-        "#version 150\n"
-        "uniform sampler2D tex;\n"
-        "in block\n"
-        "{\n"
-        "	vec4 colors;\n"
-        "	vec2 texCoords;\n"
-        "} inData;\n"
-        "out vec4 fragColor;\n"
-        "void main()\n"
-        "{\n"
-        "   vec4 tex2D = texture(tex, inData.texCoords);\n"
-        "	fragColor = tex2D * inData.colors;\n"
-        "}\n"
-    };
+        if((spanA.mpData == nullptr) || (spanB.mpData == nullptr))
+        {
+            continue;
+        } // if
+        
+        const GLubyte *pA = reinterpret_cast<const GLubyte *>(spanA.mpData);
+        const GLubyte *pB = reinterpret_cast<const GLubyte *>(spanB.mpData);
+        
+        const size_t nBytes = spanA.mnComponents * sizeof(GLfloat);
+        
+        for(GLuint i = 0; i < nCount; ++i)
+        {
+            if(std::memcmp(pA + GLsizeiptr(i) * spanA.mnStride, pB + GLsizeiptr(i) * spanB.mnStride, nBytes))
+            {
+                rFirst = std::min(rFirst, i);
+                rEnd   = std::max(rEnd, i + 1);
+            } // if
+        } // for
+    } // for
+    
+    return rFirst < rEnd;
+} // GLUTextCompareVertices
+
+// Replace the glyph vertices of a text with those of the glyph quads of a
+// new string.  With as many glyphs as before the vao is kept, and only the
+// vertices that differ are uploaded, so a counter changing a digit uploads
+// the 6 vertices of that digit.  Otherwise the vao is recreated, and the
+// program and vertex layout are kept.
+static bool GLUTextUpdateVertices(const GLU::GlyphQuads& rQuads,
+                                  const NSSize& rSize,
+                                  GLU::TextRef pText)
+{
+    // Non-perspective texts span [0, 1], and perspective texts [-1, 1]
+    const GLfloat nScale  = pText->mbOrtho2D ? 1.0f :  2.0f;
+    const GLfloat nOffset = pText->mbOrtho2D ? 0.0f : -1.0f;
+    
+    GLuint          nRanges = 0;
+    GLU::TextRange *pRanges = nullptr;
+    GLU::ArrayRef   pArray  = nullptr;
+    
+    if(!GLUTextCreateArray(rQuads,
+                           pText->mbColors ? pText->m_Colors : nullptr,
+                           nScale,
+                           nOffset,
+                           rSize,
+                           pText->mpAtlas,
+                           nRanges,
+                           pRanges,
+                           pArray))
+    {
+        return false;
+    } // if
     
-    // Create a program object from shaders, attributes and fragment data
-    pText->m_Program.mpProgram = GLU::ProgramCreate(false, kShaders[0], kShaders[1]);
+    const GLuint nCount    = (pArray != nullptr) ? GLU::ArrayGetCount(pArray) : 0;
+    const GLuint nPrevious = (pText->mpArray != nullptr) ? GLU::ArrayGetCount(pText->mpArray) : 0;
     
-    bool bSuccess = pText->m_Program.mpProgram != nullptr;
+    bool bSuccess = true;
     
-    if(bSuccess)
+    if(nCount && (nCount == nPrevious) && (pText->mpVertices != nullptr))
     {
-        // Create attributes associative array
-        GLU::UInts   vAttribKeys = {0, 1, 2};
-        GLU::Strings vAttribVals = {"position", "texCoords", "colors"};
+        GLuint nFirst = 0;
+        GLuint nEnd   = 0;
         
-        GLU::ProgramAddAttributes(vAttribKeys, vAttribVals, pText->m_Program.mpProgram);
+        if(GLUTextCompareVertices(pText->mpArray, pArray, nFirst, nEnd))
+        {
+            bSuccess = GLU::VertexArrayUpdate(pText->m_Program.mpLayout,
+                                              nFirst,
+                                              nEnd - nFirst,
+                                              pArray,
+                                              pText->mpVertices);
+        } // if
+    } // if
+    else
+    {
+        GLU::VertexArrayRef pVertices = nullptr;
         
-        // Create fragment data associative array
-        GLU::UInts   vColorKeys = { 0 };
-        GLU::Strings vColorVals = { "fragColor" };
+        if(nCount)
+        {
+            pVertices = GLU::VertexArrayCreate(pText->m_Program.mpLayout, nCount, pArray);
+            
+            bSuccess = pVertices != nullptr;
+        } // if
         
-        GLU::ProgramAddFragments(vColorKeys, vColorVals, pText->m_Program.mpProgram);
+        if(bSuccess)
+        {
+            GLU::VertexArrayDelete(pText->mpVertices);
+            
+            pText->mpVertices = pVertices;
+        } // if
+    } // else
+    
+    if(!bSuccess)
+    {
+        GLU::ArrayDelete(pArray);
         
-        // Compile and link the shaders
-        bSuccess = GLU::ProgramFinalize(pText->m_Program.mpProgram);
+        delete [] pRanges;
         
-        // Get the program object ID
-        pText->m_Program.mnPID = GLU::ProgramGetHandle(pText->m_Program.mpProgram);
+        return false;
     } // if
     
-    return bSuccess;
-} // GLUTextAcquirePerspectiveProgram
+    GLU::ArrayDelete(pText->mpArray);
+    
+    delete [] pText->mpRanges;
+    
+    pText->mnRanges = nRanges;
+    pText->mpRanges = pRanges;
+    pText->mpArray  = pArray;
+    
+    pText->mnGeneration = GLU::GlyphAtlasGetGeneration(pText->mpAtlas);
+    
+    pText->m_Program.mnVAO   = (pText->mpVertices != nullptr) ? GLU::VertexArrayGetVAO(pText->mpVertices)   : 0;
+    pText->m_Program.mnFirst = (pText->mpVertices != nullptr) ? GLU::VertexArrayGetFirst(pText->mpVertices) : 0;
+    
+    // The frame of the string scales the transformations
+    if((rSize.width != pText->m_Size.width) || (rSize.height != pText->m_Size.height))
+    {
+        pText->m_Size = rSize;
+        
+        GLUTextTransformInvalidate(GLU::kTextDirtyModelView | GLU::kTextDirtyOrtho2D, pText);
+    } // if
+    
+    // Batches the text is in rebuild their vertices
+    pText->mnRevision++;
+    
+    return true;
+} // GLUTextUpdateVertices
 
-// Acquire a program object, shaders, vao, and buffers for a perspective text
-static bool GLUTextAcquirePerspective(const NSRect& rBounds,
-                                      const GLfloat * const pColors,
-                                      GLU::TextRef pText)
+#pragma mark -
+#pragma mark Private - Utilities - Cache
+
+// Delete the glyph vertices of a text, and its cache key
+static void GLUTextDeleteVertices(GLU::TextRef pText)
+{
+    delete [] pText->mpRanges;
+    delete pText->mpKey;
+    
+    GLU::ArrayDelete(pText->mpArray);
+    GLU::VertexArrayDelete(pText->mpVertices);
+    GLU::GlyphAtlasRelease(pText->mpAtlas);
+    
+    pText->mnRanges   = 0;
+    pText->mpRanges   = nullptr;
+    pText->mpKey      = nullptr;
+    pText->mpArray    = nullptr;
+    pText->mpVertices = nullptr;
+    pText->mpAtlas    = nullptr;
+} // GLUTextDeleteVertices
+
+// Delete cached glyph vertices
+static void GLUTextCacheEntryDelete(GLU::TextCacheEntry& rEntry)
 {
-    bool bSuccess = GLUTextAcquirePerspectiveProgram(pText);
+    delete [] rEntry.mpRanges;
     
-    if(bSuccess)
+    GLU::ArrayDelete(rEntry.mpArray);
+    GLU::VertexArrayDelete(rEntry.mpVertices);
+    GLU::GlyphAtlasRelease(rEntry.mpAtlas);
+} // GLUTextCacheEntryDelete
+
+// The cache of the share group of the current context, null if it could
+// not be created
+static GLU::TextCache *GLUTextCacheGet()
+{
+    CGLShareGroupObj pShareGroup = CGLGetShareGroup(CGLGetCurrentContext());
+    
+    try
     {
-        // Initial zoom value
-        pText->m_Transform.mnZoom = 0.5f;
+        auto pIter = GLU::gTextCaches.find(pShareGroup);
         
-        // Initial field-of-view 45 degreess
-        pText->m_Transform.mnFovy = GLM::kPiDiv4_f;
+        if(pIter == GLU::gTextCaches.end())
+        {
+            GLU::TextCache cache = {GLU::gTextCacheBudget, 0, 0, 0, 0};
+            
+            pIter = GLU::gTextCaches.emplace(pShareGroup, std::move(cache)).first;
+        } // if
         
-        // Rotation parameters are { x, y, z, θ }
-        const vector_float4 rotate = {0.0f, 0.0f, 1.0f, 0.0f};
+        return &pIter->second;
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for the text cache: \"%s\"", ba.what());
+    } // catch
+    
+    return nullptr;
+} // GLUTextCacheGet
+
+// Evict the least recently deleted vertices until the cache is within a
+// budget
+static void GLUTextCacheEvict(const GLsizeiptr& rBudget,
+                              GLU::TextCache& rCache)
+{
+    while((rCache.mnBytes > rBudget) && !rCache.m_Entries.empty())
+    {
+        GLU::TextCacheEntry& rEntry = rCache.m_Entries.back();
         
-        // Translation in the rectangular Cartesian coordinatines
-        const vector_float3 translate = {0.0f, 0.0f, 0.5f};
+        rCache.mnBytes -= rEntry.mnBytes;
         
-        // Enable th model-view-projection matrix
-        GLUTextUniformEnableMVP("mvp", rBounds, translate, rotate, pText);
+        rCache.m_Index.erase(rEntry.m_Key);
         
-        // Enable the sampler 2D
-        GLUTextUniformEnableSampler2D("tex", pText);
+        GLUTextCacheEntryDelete(rEntry);
+        
+        rCache.m_Entries.pop_back();
+        
+        rCache.mnEvictions++;
+    } // while
+} // GLUTextCacheEvict
+
+// The UTF-8 bytes of a core foundation string
+static GLU::String GLUTextCacheGetString(CFStringRef pString)
+{
+    GLU::String string;
+    
+    if(pString != nullptr)
+    {
+        const CFIndex nSize = CFStringGetMaximumSizeForEncoding(CFStringGetLength(pString), kCFStringEncodingUTF8) + 1;
         
-        // Create a triangle fan
-        GLUTextQuadCreatePerspective("position", "colors", pColors, "texCoords", pText);
+        std::vector<GLchar> buffer(nSize);
+        
+        if(CFStringGetCString(pString, buffer.data(), nSize, kCFStringEncodingUTF8))
+        {
+            string = buffer.data();
+        } // if
     } // if
     
-    return bSuccess;
-} // GLUTextAcquirePerspective
+    return string;
+} // GLUTextCacheGetString
 
-static bool GLUTextAcquireNonPerspectiveProgram(GLU::TextRef pText)
+// The cache key of the glyph vertices of a text.  Fixed size fields come
+// first, then the font name terminated, so the string that ends the key
+// cannot be confused with them.
+static GLU::String GLUTextCacheKey(const bool& rOrtho2D,
+                                   const GLU::String& rString,
+                                   const GLU::String& rFontName,
+                                   const CGFloat& rFontSize,
+                                   const CTTextAlignment& rAlignment,
+                                   const GLfloat * const pColors)
 {
-    // create HUD vertex and fragment shader sources
-    const GLchar *kShaders[2] =
+    GLU::String key;
+    
+    key.push_back(rOrtho2D ? 'o' : 'p');
+    key.push_back(pColors ? 'c' : 'w');
+    
+    key.append(reinterpret_cast<const GLchar *>(&rFontSize), sizeof(CGFloat));
+    key.append(reinterpret_cast<const GLchar *>(&rAlignment), sizeof(CTTextAlignment));
+    
+    if(pColors != nullptr)
     {
-        // Vertex Shader
-        "#version 150\n"
-        "uniform vec4 ortho;\n"
-        "in vec4 colors;\n"
-        "in vec2 positions;\n"
-        "out block\n"
-        "{\n"
-        "    vec4 colors;\n"
-        "    vec2 texCoords;\n"
-        "} outData;\n"
-        "void main()\n"
-        "{\n"
-        "   outData.colors    = colors;\n"
-        "	outData.texCoords = positions;\n"
-        "	gl_Position = vec4(positions * ortho.xy + ortho.zw, 0.0, 1.0);\n"
-        "}\n",
-        
-        // Fragment Shader
-        "#version 150\n"
-        "uniform sampler2D tex;\n"
-        "in block\n"
-        "{\n"
-        "	vec4 colors;\n"
-        "	vec2 texCoords;\n"
-        "} inData;\n"
-        "out vec4 fragColor;\n"
-        "void main()\n"
-        "{\n"
-        "   vec4 tex2D = texture(tex, inData.texCoords);\n"
-        "	fragColor = tex2D * inData.colors;\n"
-        "}\n"
-    };
+        key.append(reinterpret_cast<const GLchar *>(pColors), 16 * sizeof(GLfloat));
+    } // if
     
-    // Create a program object from shaders, attributes and fragment data
-    pText->m_Program.mpProgram = GLU::ProgramCreate(false, kShaders[0], kShaders[1]);
+    key.append(rFontName);
+    key.push_back('\0');
+    key.append(rString);
     
-    bool bSuccess = pText->m_Program.mpProgram != nullptr;
+    return key;
+} // GLUTextCacheKey
+
+// Take the glyph vertices of a deleted text with the same key out of the
+// cache.  The text keeps the key to return its vertices when it is deleted.
+static bool GLUTextCacheAcquire(const bool& rOrtho2D,
+                                const GLU::String& rString,
+                                const GLU::String& rFontName,
+                                const CGFloat& rFontSize,
+                                const CTTextAlignment& rAlignment,
+                                const GLfloat * const pColors,
+                                GLU::TextRef pText)
+{
+    GLU::TextCache *pCache = GLUTextCacheGet();
     
-    if(bSuccess)
+    if(pCache == nullptr)
+    {
+        return false;
+    } // if
+    
+    GLU::TextCache& rCache = *pCache;
+    
+    GLU::String key = GLUTextCacheKey(rOrtho2D, rString, rFontName, rFontSize, rAlignment, pColors);
+    
+    auto pIndex = rCache.m_Index.find(key);
+    
+    pText->mpKey = new GLU::String(std::move(key));
+    
+    if(pIndex == rCache.m_Index.end())
     {
-        // Create attributes associative array
-        GLU::UInts   vAttribKeys = { 3, 4 };
-        GLU::Strings vAttribVals = { "positions", "colors" };
+        rCache.mnMisses++;
         
-        GLU::ProgramAddAttributes(vAttribKeys, vAttribVals, pText->m_Program.mpProgram);
+        return false;
+    } // if
+    
+    GLU::TextCacheEntry& rEntry = *pIndex->second;
+    
+    // Glyphs moved by a reset of the atlas since the text was deleted
+    if(rEntry.mnGeneration != GLU::GlyphAtlasGetGeneration(rEntry.mpAtlas))
+    {
+        rCache.mnBytes -= rEntry.mnBytes;
         
-        // Create fragment data associative array
-        GLU::UInts   vColorKeys = { 0 };
-        GLU::Strings vColorVals = { "fragColor" };
+        GLUTextCacheEntryDelete(rEntry);
         
-        GLU::ProgramAddFragments(vColorKeys, vColorVals, pText->m_Program.mpProgram);
+        rCache.m_Entries.erase(pIndex->second);
+        rCache.m_Index.erase(pIndex);
         
-        // Compile and link the shaders
-        bSuccess = GLU::ProgramFinalize(pText->m_Program.mpProgram);
+        rCache.mnMisses++;
         
-        // Get the program object ID
-        pText->m_Program.mnPID = GLU::ProgramGetHandle(pText->m_Program.mpProgram);
+        return false;
     } // if
     
-    return bSuccess;
-} // GLUTextAcquireNonPerspectiveProgram
+    pText->m_Size     = rEntry.m_Size;
+    pText->mnRanges   = rEntry.mnRanges;
+    pText->mpRanges   = rEntry.mpRanges;
+    pText->mpArray    = rEntry.mpArray;
+    pText->mpVertices = rEntry.mpVertices;
+    pText->mpAtlas    = rEntry.mpAtlas;
+    pText->mnScale    = rEntry.mnScale;
+    
+    pText->mnGeneration = rEntry.mnGeneration;
+    
+    rCache.mnBytes -= rEntry.mnBytes;
+    
+    rCache.m_Entries.erase(pIndex->second);
+    rCache.m_Index.erase(pIndex);
+    
+    rCache.mnHits++;
+    
+    return true;
+} // GLUTextCacheAcquire
 
-// Acquire a program object, shaders, vao, and buffers for a nonperspective text
-static bool GLUTextAcquireNonPerspective(const NSRect& rBounds,
-                                         const NSPoint& rPosition,
-                                         const GLfloat * const pColors,
-                                         GLU::TextRef pText)
+// Take the glyph vertices of a deleted text with the same core foundation
+// string, font, size, alignment, and colors out of the cache
+static bool GLUTextCacheAcquire(const bool& rOrtho2D,
+                                CFStringRef pString,
+                                CFStringRef pFontName,
+                                const CGFloat& rFontSize,
+                                const CTTextAlignment& rAlignment,
+                                const GLfloat * const pColors,
+                                GLU::TextRef pText)
+{
+    return GLUTextCacheAcquire(rOrtho2D,
+                               GLUTextCacheGetString(pString),
+                               GLUTextCacheGetString(pFontName),
+                               rFontSize,
+                               rAlignment,
+                               pColors,
+                               pText);
+} // GLUTextCacheAcquire
+
+// Keep the glyph vertices of a deleted text in the cache, and evict the
+// least recently deleted beyond the budget.  Returns false if they were
+// not cached and must be deleted.
+static bool GLUTextCacheRelease(GLU::TextRef pText)
 {
-    bool bSuccess = GLUTextAcquireNonPerspectiveProgram(pText);
+    if((pText->mpKey == nullptr) || (pText->mpVertices == nullptr))
+    {
+        return false;
+    } // if
     
-    if(bSuccess)
+    GLU::TextCache *pCache = GLUTextCacheGet();
+    
+    if((pCache == nullptr) || pCache->m_Index.count(*pText->mpKey))
     {
-        // Set text position within a view
-        pText->m_Position = rPosition;
-        
-        // Enable the uniforms
-        GLUTextUniformEnableOrtho2D("ortho", rBounds, pText);
-        
-        // Enable sampler 2D
-        GLUTextUniformEnableSampler2D("tex", pText);
-        
-        // Create a triangle fan
-        GLUTextQuadCreateNonPerspective("colors", pColors, "positions", pText);
+        return false;
     } // if
     
-    return bSuccess;
-} // GLUTextAcquireNonPerspective
+    GLU::TextCache& rCache = *pCache;
+    
+    const GLsizeiptr nBytes = GLsizeiptr(GLU::ArrayGetCount(pText->mpArray))
+                            * GLU::VertexLayoutGetStride(pText->m_Program.mpLayout);
+    
+    if(nBytes > rCache.mnBudget)
+    {
+        return false;
+    } // if
+    
+    try
+    {
+        rCache.m_Entries.push_front({*pText->mpKey,
+                                     pText->m_Size,
+                                     pText->mnRanges,
+                                     pText->mpRanges,
+                                     pText->mpArray,
+                                     pText->mpVertices,
+                                     pText->mpAtlas,
+                                     pText->mnScale,
+                                     pText->mnGeneration,
+                                     nBytes});
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        return false;
+    } // catch
+    
+    try
+    {
+        rCache.m_Index.emplace(*pText->mpKey, rCache.m_Entries.begin());
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        rCache.m_Entries.pop_front();
+        
+        return false;
+    } // catch
+    
+    rCache.mnBytes += nBytes;
+    
+    // The vao belongs to the context deleting the text
+    GLU::VertexArrayDetach(pText->mpVertices);
+    
+    delete pText->mpKey;
+    
+    pText->mnRanges   = 0;
+    pText->mpRanges   = nullptr;
+    pText->mpKey      = nullptr;
+    pText->mpArray    = nullptr;
+    pText->mpVertices = nullptr;
+    pText->mpAtlas    = nullptr;
+    
+    GLUTextCacheEvict(rCache.mnBudget, rCache);
+    
+    return true;
+} // GLUTextCacheRelease
 
 #pragma mark -
-#pragma mark Private - Utilities - Blending
+#pragma mark Private - Utilities - Jobs
 
-static bool GLUTextCheckBlending(const GLenum& nFactor)
+// Lay out the string of a job, and generate the fields of its new glyphs,
+// on a worker thread
+static void GLUTextJobLayout(void *pContext)
 {
-    bool bSuccess = false;
+    GLU::TextJob *pJob = static_cast<GLU::TextJob *>(pContext);
     
-    switch(nFactor)
+    if(pJob->mpAttrString != nullptr)
     {
-        case GL_ZERO:
-        case GL_ONE:
-        case GL_SRC_COLOR:
-        case GL_ONE_MINUS_SRC_COLOR:
-        case GL_SRC_ALPHA:
-        case GL_ONE_MINUS_SRC_ALPHA:
-        case GL_DST_ALPHA:
-        case GL_ONE_MINUS_DST_ALPHA:
-        case GL_DST_COLOR:
-        case GL_ONE_MINUS_DST_COLOR:
-        case GL_SRC_ALPHA_SATURATE:
-            bSuccess = true;
-            break;
-            
-        default:
-            break;
-    } // switch
+        pJob->mpLayout = GLU::GlyphAtlasLayoutCreate(pJob->mpAttrString, pJob->mnScale, pJob->mpAtlas);
+    } // if
+    else
+    {
+        pJob->mpLayout = GLU::GlyphAtlasLayoutCreate(pJob->mpString,
+                                                     pJob->mpFontName,
+                                                     pJob->mnFontSize,
+                                                     pJob->mnAlignment,
+                                                     pJob->mnScale,
+                                                     pJob->mpAtlas);
+    } // else
+} // GLUTextJobLayout
+
+static void GLUTextJobDelete(GLU::TextJob *pJob)
+{
+    if(pJob != nullptr)
+    {
+        if(pJob->mpGroup != nullptr)
+        {
+            dispatch_release(pJob->mpGroup);
+        } // if
+        
+        if(pJob->mpString != nullptr)
+        {
+            CFRelease(pJob->mpString);
+        } // if
+        
+        if(pJob->mpAttrString != nullptr)
+        {
+            CFRelease(pJob->mpAttrString);
+        } // if
+        
+        if(pJob->mpFontName != nullptr)
+        {
+            CFRelease(pJob->mpFontName);
+        } // if
+        
+        GLU::GlyphAtlasLayoutDelete(pJob->mpLayout);
+        
+        delete pJob;
+    } // if
+} // GLUTextJobDelete
+
+// Create a job from copies of a string, or of an attributed string, so the
+// caller may change them while it runs
+static GLU::TextJob *GLUTextJobCreate(CFStringRef pString,
+                                      CFAttributedStringRef pAttrString,
+                                      GLU::TextRef pText)
+{
+    GLU::TextJob *pJob = nullptr;
+    
+    try
+    {
+        pJob = new GLU::TextJob;
+        
+        pJob->mpGroup      = nullptr;
+        pJob->mpString     = nullptr;
+        pJob->mpAttrString = nullptr;
+        pJob->mpFontName   = nullptr;
+        pJob->mnFontSize   = pText->mnFontSize;
+        pJob->mnAlignment  = pText->mnAlignment;
+        pJob->mnScale      = pText->mnScale;
+        pJob->mpAtlas      = pText->mpAtlas;
+        pJob->mpLayout     = nullptr;
+        
+        if(pAttrString != nullptr)
+        {
+            pJob->mpAttrString = CFAttributedStringCreateCopy(kCFAllocatorDefault, pAttrString);
+        } // if
+        else
+        {
+            pJob->mpString = CFStringCreateCopy(kCFAllocatorDefault, pString);
+            
+            if(pText->mpFontName != nullptr)
+            {
+                pJob->mpFontName = CFStringRef(CFRetain(pText->mpFontName));
+            } // if
+            
+            pJob->m_Key = GLUTextCacheKey(pText->mbOrtho2D,
+                                          GLUTextCacheGetString(pString),
+                                          GLUTextCacheGetString(pText->mpFontName),
+                                          pText->mnFontSize,
+                                          pText->mnAlignment,
+                                          pText->mbColors ? pText->m_Colors : nullptr);
+        } // else
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for changing the string of a text: \"%s\"", ba.what());
+        
+        GLUTextJobDelete(pJob);
+        
+        return nullptr;
+    } // catch
+    
+    if((pJob->mpString == nullptr) && (pJob->mpAttrString == nullptr))
+    {
+        GLUTextJobDelete(pJob);
+        
+        return nullptr;
+    } // if
+    
+    return pJob;
+} // GLUTextJobCreate
+
+// Run a job on the default priority global queue
+static bool GLUTextJobStart(GLU::TextJob *pJob)
+{
+    pJob->mpGroup = dispatch_group_create();
+    
+    if(pJob->mpGroup == nullptr)
+    {
+        return false;
+    } // if
+    
+    dispatch_group_async_f(pJob->mpGroup,
+                           dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                           pJob,
+                           GLUTextJobLayout);
+    
+    return true;
+} // GLUTextJobStart
+
+// Start a job if none runs for the text, otherwise keep it to start after
+// the running one, replacing a job already waiting, as only the latest
+// string is shown
+static bool GLUTextJobQueue(GLU::TextJob *pJob,
+                            GLU::TextRef pText)
+{
+    if(pText->mpJob != nullptr)
+    {
+        GLUTextJobDelete(pText->mpNext);
+        
+        pText->mpNext = pJob;
+    } // if
+    else if(GLUTextJobStart(pJob))
+    {
+        pText->mpJob = pJob;
+    } // else if
+    else
+    {
+        NSLog(@">> ERROR: Failed creating a dispatch group for changing the string of a text!");
+        
+        GLUTextJobDelete(pJob);
+        
+        return false;
+    } // else
+    
+    return true;
+} // GLUTextJobQueue
+
+// Commit the layout of the job of a text if it is done, without waiting,
+// and start the job waiting for it.  The text keeps its previous glyphs
+// until then, or if the layout failed.  True if its glyphs changed.
+static bool GLUTextJobFinish(GLU::TextRef pText)
+{
+    GLU::TextJob *pJob = pText->mpJob;
+    
+    if((pJob == nullptr) || dispatch_group_wait(pJob->mpGroup, DISPATCH_TIME_NOW))
+    {
+        return false;
+    } // if
+    
+    bool bSuccess = false;
+    
+    try
+    {
+        NSSize size = pText->m_Size;
+        
+        GLU::GlyphQuads quads;
+        
+        bSuccess = GLU::GlyphAtlasLayoutCommit(pJob->mpLayout, size, quads, pText->mpAtlas)
+                && GLUTextUpdateVertices(quads, size, pText);
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for changing the string of a text: \"%s\"", ba.what());
+        
+        bSuccess = false;
+    } // catch
+    
+    if(bSuccess)
+    {
+        GLUTextSetSource(pJob->mpString, pJob->mpAttrString, pText);
+        
+        if(pJob->mpAttrString != nullptr)
+        {
+            // Texts of attributed strings are not cached
+            delete pText->mpKey;
+            
+            pText->mpKey = nullptr;
+        } // if
+        else if(pText->mpKey != nullptr)
+        {
+            // Cached under the new string when the text is deleted
+            pText->mpKey->swap(pJob->m_Key);
+        } // else if
+    } // if
+    else
+    {
+        NSLog(@">> ERROR: Failed changing the string of a text, keeping the previous one!");
+    } // else
+    
+    pText->mpJob = nullptr;
+    
+    GLUTextJobDelete(pJob);
+    
+    GLU::TextJob *pNext = pText->mpNext;
+    
+    if(pNext != nullptr)
+    {
+        pText->mpNext = nullptr;
+        
+        GLUTextJobQueue(pNext, pText);
+    } // if
+    
+    return bSuccess;
+} // GLUTextJobFinish
+
+// Wait for the running job of a text and drop it, with the job waiting for
+// it, before the text is changed synchronously or deleted
+static void GLUTextJobCancel(GLU::TextRef pText)
+{
+    if(pText->mpJob != nullptr)
+    {
+        dispatch_group_wait(pText->mpJob->mpGroup, DISPATCH_TIME_FOREVER);
+        
+        GLUTextJobDelete(pText->mpJob);
+        
+        pText->mpJob = nullptr;
+    } // if
+    
+    GLUTextJobDelete(pText->mpNext);
+    
+    pText->mpNext = nullptr;
+} // GLUTextJobCancel
+
+#pragma mark -
+#pragma mark Private - Utilities - Defaults
+
+static void GLUTextSetDefaults(GLU::TextRef pText)
+{
+    // Clear the sturcture
+    std::memset(pText, 0x0, sizeof(GLU::Text));
+    
+    // Blend function source factor
+    pText->mnFactor[0] = GL_SRC_ALPHA;
+    
+    // Blend function destination factor
+    pText->mnFactor[1] = GL_ONE;
+} // GLUTextSetDefaults
+
+#pragma mark -
+#pragma mark Private - Utilities - Acquire
+
+static bool GLUTextAcquirePerspectiveProgram(GLU::TextRef pText)
+{
+    // Default vertex and fragment shaders
+    const GLchar *kShaders[2] =
+    {
+        // Vertex shader
+        "#version 150\n"
+        "layout(std140, row_major) uniform Transforms\n"
+        "{\n"
+        "    mat4 mvp;\n"
+        "    vec4 ortho;\n"
+        "};\n"
+        "in vec2 position;\n"
+        "in vec2 texCoords;\n"
+        "in vec4 colors;\n"
+        "out block\n"
+        "{\n"
+        "    vec2 texCoords;\n"
+        "    vec4 colors;\n"
+        "} outData;\n"
+        "void main()\n"
+        "{\n"
+        "   outData.colors    = colors;\n"
+        "	outData.texCoords = texCoords;\n"
+        "	gl_Position = mvp * vec4(position,0.0,1.0);\n"
+        "}\n",
+        
+        // Fragment shader
+        GLU::kTextFragmentShader
+    };
+    
+    // Create attributes associative array
+    const GLU::UInts   vAttribKeys = {0, 1, 2};
+    const GLU::Strings vAttribVals = {"position", "texCoords", "colors"};
+    
+    // Create fragment data associative array
+    const GLU::UInts   vColorKeys = { 0 };
+    const GLU::Strings vColorVals = { "fragColor" };
+    
+    // Share the program object of the same shaders, attributes and fragment
+    // data, compiled and linked only for its first consumer
+    pText->m_Program.mpProgram = GLU::ProgramAcquire(kShaders[0], kShaders[1], vAttribKeys, vAttribVals, vColorKeys, vColorVals);
+    
+    bool bSuccess = pText->m_Program.mpProgram != nullptr;
+    
+    if(bSuccess)
+    {
+        // Get the program object ID
+        pText->m_Program.mnPID = GLU::ProgramGetHandle(pText->m_Program.mpProgram);
+    } // if
+    
+    return bSuccess;
+} // GLUTextAcquirePerspectiveProgram
+
+// Acquire a program object, shaders, vao, and buffers for a perspective text
+static bool GLUTextAcquirePerspective(const NSRect& rBounds,
+                                      const GLU::GlyphQuads& rQuads,
+                                      const GLfloat * const pColors,
+                                      GLU::TextRef pText)
+{
+    bool bSuccess = GLUTextAcquirePerspectiveProgram(pText) && GLUTextUniformEnableTransforms(pText->m_Program.mnPID);
+    
+    if(bSuccess)
+    {
+        // Initial zoom value
+        pText->m_Transform.mnZoom = 0.5f;
+        
+        // Initial field-of-view 45 degreess
+        pText->m_Transform.mnFovy = GLM::kPiDiv4_f;
+        
+        // Rotation parameters are { x, y, z, θ }
+        const vector_float4 rotate = {0.0f, 0.0f, 1.0f, 0.0f};
+        
+        // Translation in the rectangular Cartesian coordinatines
+        const vector_float3 translate = {0.0f, 0.0f, 0.5f};
+        
+        // Enable th model-view-projection matrix
+        GLUTextTransformSetMVP(rBounds, translate, rotate, pText);
+        
+        // Enable the sampler 2D
+        GLUTextUniformEnableSampler2D("tex", pText);
+        
+        // Create the glyph triangles
+        bSuccess = GLUTextVerticesCreatePerspective("position", "colors", pColors, "texCoords", rQuads, pText);
+        
+        if(!bSuccess)
+        {
+            GLUTextUniformDisableTransforms();
+        } // if
+    } // if
+    
+    return bSuccess;
+} // GLUTextAcquirePerspective
+
+static bool GLUTextAcquireNonPerspectiveProgram(GLU::TextRef pText)
+{
+    // create HUD vertex and fragment shader sources
+    const GLchar *kShaders[2] =
+    {
+        // Vertex Shader
+        "#version 150\n"
+        "layout(std140, row_major) uniform Transforms\n"
+        "{\n"
+        "    mat4 mvp;\n"
+        "    vec4 ortho;\n"
+        "};\n"
+        "in vec4 colors;\n"
+        "in vec2 positions;\n"
+        "in vec2 texCoords;\n"
+        "out block\n"
+        "{\n"
+        "    vec2 texCoords;\n"
+        "    vec4 colors;\n"
+        "} outData;\n"
+        "void main()\n"
+        "{\n"
+        "   outData.colors    = colors;\n"
+        "	outData.texCoords = texCoords;\n"
+        "	gl_Position = vec4(positions * ortho.xy + ortho.zw, 0.0, 1.0);\n"
+        "}\n",
+        
+        // Fragment Shader
+        GLU::kTextFragmentShader
+    };
+    
+    // Create attributes associative array
+    const GLU::UInts   vAttribKeys = { 3, 4, 5 };
+    const GLU::Strings vAttribVals = { "positions", "colors", "texCoords" };
+    
+    // Create fragment data associative array
+    const GLU::UInts   vColorKeys = { 0 };
+    const GLU::Strings vColorVals = { "fragColor" };
+    
+    // Share the program object of the same shaders, attributes and fragment
+    // data, compiled and linked only for its first consumer
+    pText->m_Program.mpProgram = GLU::ProgramAcquire(kShaders[0], kShaders[1], vAttribKeys, vAttribVals, vColorKeys, vColorVals);
+    
+    bool bSuccess = pText->m_Program.mpProgram != nullptr;
+    
+    if(bSuccess)
+    {
+        // Get the program object ID
+        pText->m_Program.mnPID = GLU::ProgramGetHandle(pText->m_Program.mpProgram);
+    } // if
+    
+    return bSuccess;
+} // GLUTextAcquireNonPerspectiveProgram
+
+// Acquire a program object, shaders, vao, and buffers for a nonperspective text
+static bool GLUTextAcquireNonPerspective(const NSRect& rBounds,
+                                         const NSPoint& rPosition,
+                                         const GLU::GlyphQuads& rQuads,
+                                         const GLfloat * const pColors,
+                                         GLU::TextRef pText)
+{
+    bool bSuccess = GLUTextAcquireNonPerspectiveProgram(pText) && GLUTextUniformEnableTransforms(pText->m_Program.mnPID);
+    
+    if(bSuccess)
+    {
+        // Positioned by the orthographic 2D linear transformation
+        pText->mbOrtho2D = true;
+        
+        // Set text position within a view
+        pText->m_Position = rPosition;
+        
+        // Set the text-view bounds for the orthographic 2D linear transformation
+        GLUTextSetBounds(rBounds, pText);
+        
+        GLUTextTransformInvalidate(GLU::kTextDirtyOrtho2D, pText);
+        
+        // Enable sampler 2D
+        GLUTextUniformEnableSampler2D("tex", pText);
+        
+        // Create the glyph triangles
+        bSuccess = GLUTextVerticesCreateNonPerspective("positions", "colors", pColors, "texCoords", rQuads, pText);
+        
+        if(!bSuccess)
+        {
+            GLUTextUniformDisableTransforms();
+        } // if
+    } // if
+    
+    return bSuccess;
+} // GLUTextAcquireNonPerspective
+
+// Release the program object and vertex layout of a text that could not
+// be created, whichever of them it got
+static void GLUTextReleaseProgram(GLU::TextRef pText)
+{
+    GLU::VertexLayoutDelete(pText->m_Program.mpLayout);
+    GLU::ProgramRelease(pText->m_Program.mpProgram);
+    
+    pText->m_Program.mpLayout  = nullptr;
+    pText->m_Program.mpProgram = nullptr;
+    pText->m_Program.mnPID     = 0;
+} // GLUTextReleaseProgram
+
+#pragma mark -
+#pragma mark Private - Utilities - Blending
+
+static bool GLUTextCheckBlending(const GLenum& nFactor)
+{
+    bool bSuccess = false;
+    
+    switch(nFactor)
+    {
+        case GL_ZERO:
+        case GL_ONE:
+        case GL_SRC_COLOR:
+        case GL_ONE_MINUS_SRC_COLOR:
+        case GL_SRC_ALPHA:
+        case GL_ONE_MINUS_SRC_ALPHA:
+        case GL_DST_ALPHA:
+        case GL_ONE_MINUS_DST_ALPHA:
+        case GL_DST_COLOR:
+        case GL_ONE_MINUS_DST_COLOR:
+        case GL_SRC_ALPHA_SATURATE:
+            bSuccess = true;
+            break;
+            
+        default:
+            break;
+    } // switch
+    
+    return bSuccess;
+} // GLUTextCheckBlending
+
+#pragma mark -
+#pragma mark Private - Utilities - Batch
+
+static bool GLUTextBatchAcquireProgram(GLU::TextBatchRef pBatch)
+{
+    // Batch vertex and fragment shaders.  The vertices of each text index
+    // its transformation with the z coordinate of their position.
+    const GLchar *kShaders[2] =
+    {
+        // Vertex shader
+        "#version 150\n"
+        "layout(std140, row_major) uniform Transforms\n"
+        "{\n"
+        "    mat4 mvp[64];\n"
+        "};\n"
+        "in vec3 position;\n"
+        "in vec2 texCoords;\n"
+        "in vec4 colors;\n"
+        "out block\n"
+        "{\n"
+        "    vec2 texCoords;\n"
+        "    vec4 colors;\n"
+        "} outData;\n"
+        "void main()\n"
+        "{\n"
+        "    outData.colors    = colors;\n"
+        "    outData.texCoords = texCoords;\n"
+        "    gl_Position = mvp[int(position.z)] * vec4(position.xy,0.0,1.0);\n"
+        "}\n",
+        
+        // Fragment shader
+        GLU::kTextFragmentShader
+    };
+    
+    // Create attributes associative array
+    const GLU::UInts   vAttribKeys = {0, 1, 2};
+    const GLU::Strings vAttribVals = {"position", "texCoords", "colors"};
+    
+    // Create fragment data associative array
+    const GLU::UInts   vColorKeys = { 0 };
+    const GLU::Strings vColorVals = { "fragColor" };
+    
+    // Share the program object of the same shaders, attributes and fragment
+    // data, compiled and linked only for its first consumer
+    pBatch->mpProgram = GLU::ProgramAcquire(kShaders[0], kShaders[1], vAttribKeys, vAttribVals, vColorKeys, vColorVals);
+    
+    bool bSuccess = pBatch->mpProgram != nullptr;
+    
+    if(bSuccess)
+    {
+        // Get the program object ID
+        pBatch->mnPID = GLU::ProgramGetHandle(pBatch->mpProgram);
+    } // if
+    
+    if(bSuccess)
+    {
+        // 0 for GL_TEXTURE0
+        glUseProgram(pBatch->mnPID);
+        glUniform1i(glGetUniformLocation(pBatch->mnPID, "tex"), 0);
+        
+        pBatch->mpLayout = GLU::VertexLayoutCreate(pBatch->mnPID,
+                                                   GLU::kArrayLayout3D,
+                                                   "position",
+                                                   nullptr,
+                                                   "texCoords",
+                                                   "colors",
+                                                   GLU::kTextVertexTypes);
+        
+        bSuccess = pBatch->mpLayout != nullptr;
+    } // if
+    
+    return bSuccess;
+} // GLUTextBatchAcquireProgram
+
+// Model-view-projection of a text of a batch.  The matrix is staged
+// without transposing it, see TextBlock, so its columns are the rows
+// multiplying positions in the shader.
+static matrix_float4x4 GLUTextBatchGetMVP(const GLU::TextRef pText)
+{
+    if(!pText->mbOrtho2D)
+    {
+        return pText->m_Block.m_MVP;
+    } // if
+    
+    const vector_float4 ortho = pText->m_Block.m_Ortho2D;
+    
+    simd::float4x4 M = matrix_identity_float4x4;
+    
+    M.columns[0].x = ortho.x;
+    M.columns[0].w = ortho.z;
+    M.columns[1].y = ortho.y;
+    M.columns[1].w = ortho.w;
+    
+    return M;
+} // GLUTextBatchGetMVP
+
+// Order two page ranges of a batch by blending factors, then by page
+static bool GLUTextBatchCompare(const GLU::TextBatchDraw& rA,
+                                const GLU::TextBatchDraw& rB)
+{
+    if(rA.mnFactor[0] != rB.mnFactor[0])
+    {
+        return rA.mnFactor[0] < rB.mnFactor[0];
+    } // if
+    
+    if(rA.mnFactor[1] != rB.mnFactor[1])
+    {
+        return rA.mnFactor[1] < rB.mnFactor[1];
+    } // if
+    
+    return rA.mnTID < rB.mnTID;
+} // GLUTextBatchCompare
+
+// Pack the glyph vertices of every text of the batch into one vertex
+// buffer, sorted by blending factors and atlas page, and merge the ranges
+// sharing both into a draw
+static bool GLUTextBatchBuild(GLU::TextBatchRef pBatch)
+{
+    GLU::VertexArrayDelete(pBatch->mpVertices);
+    
+    pBatch->mpVertices = nullptr;
+    pBatch->mnVAO      = 0;
+    pBatch->mnFirst    = 0;
+    
+    bool bSuccess = true;
+    
+    try
+    {
+        // Page ranges of every text, from the text's first vertex, and the
+        // slots of their texts
+        std::vector<GLU::TextBatchDraw> ranges;
+        std::vector<GLuint>             slots;
+        
+        GLuint nCount = 0;
+        
+        for(GLuint i = 0; i < pBatch->m_Slots.size(); ++i)
+        {
+            const GLU::TextBatchSlot& rSlot = pBatch->m_Slots[i];
+            
+            for(GLuint j = 0; j < rSlot.mpText->mnRanges; ++j)
+            {
+                const GLU::TextRange& rRange = rSlot.mpText->mpRanges[j];
+                
+                ranges.push_back({{rSlot.mnFactor[0], rSlot.mnFactor[1]}, rRange.mnTID, rRange.mnFirst, rRange.mnCount});
+                slots.push_back(i);
+                
+                nCount += rRange.mnCount;
+            } // for
+        } // for
+        
+        std::vector<GLuint> order(ranges.size());
+        
+        for(GLuint i = 0; i < order.size(); ++i)
+        {
+            order[i] = i;
+        } // for
+        
+        std::stable_sort(order.begin(), order.end(), [&ranges](const GLuint& a, const GLuint& b) {
+            return GLUTextBatchCompare(ranges[a], ranges[b]);
+        });
+        
+        std::vector<GLfloat> positions(3 * nCount);
+        std::vector<GLfloat> texCoords(3 * nCount);
+        std::vector<GLfloat> colors(4 * nCount);
+        
+        GLfloat *pPosition = positions.data();
+        GLfloat *pTexCoord = texCoords.data();
+        GLfloat *pColor    = colors.data();
+        
+        GLuint nFirst = 0;
+        
+        pBatch->m_Draws.clear();
+        
+        for(const GLuint& rIndex : order)
+        {
+            const GLU::TextBatchDraw& rRange = ranges[rIndex];
+            
+            const GLuint        nSlot  = slots[rIndex];
+            const GLU::ArrayRef pArray = pBatch->m_Slots[nSlot].mpText->mpArray;
+            
+            for(GLuint k = rRange.mnFirst; k < (rRange.mnFirst + rRange.mnCount); ++k)
+            {
+                const vector_float2 position = GLU::ArrayGetPosition2D(k, pArray);
+                const vector_float2 texCoord = GLU::ArrayGetTexCoords2D(k, pArray);
+                const vector_float4 color    = GLU::ArrayGetColors(k, pArray);
+                
+                pPosition[0] = position.x;
+                pPosition[1] = position.y;
+                pPosition[2] = GLfloat(nSlot);
+                
+                pTexCoord[0] = texCoord.x;
+                pTexCoord[1] = texCoord.y;
+                pTexCoord[2] = 0.0f;
+                
+                pColor[0] = color.x;
+                pColor[1] = color.y;
+                pColor[2] = color.z;
+                pColor[3] = color.w;
+                
+                pPosition += 3;
+                pTexCoord += 3;
+                pColor    += 4;
+            } // for
+            
+            // Ranges sorted after the last draw start a new one, the others
+            // share its blending factors and page, and extend it
+            if(pBatch->m_Draws.empty() || GLUTextBatchCompare(pBatch->m_Draws.back(), rRange))
+            {
+                pBatch->m_Draws.push_back({{rRange.mnFactor[0], rRange.mnFactor[1]}, rRange.mnTID, nFirst, 0});
+            } // if
+            
+            pBatch->m_Draws.back().mnCount += rRange.mnCount;
+            
+            nFirst += rRange.mnCount;
+        } // for
+        
+        if(nCount)
+        {
+            std::vector<GLubyte> storage(GLU::ArrayGetStorageSize(GLU::kArrayLayout3D, nCount));
+            
+            GLU::ArrayRef pArray = GLU::ArrayCreateWithStorage(nCount,
+                                                               positions.data(),
+                                                               nullptr,
+                                                               texCoords.data(),
+                                                               colors.data(),
+                                                               storage.data());
+            
+            if(pArray != nullptr)
+            {
+                pBatch->mpVertices = GLU::VertexArrayCreate(pBatch->mpLayout, nCount, pArray);
+                
+                GLU::ArrayDelete(pArray);
+            } // if
+            
+            bSuccess = pBatch->mpVertices != nullptr;
+        } // if
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for the vertices of a text batch: \"%s\"", ba.what());
+        
+        bSuccess = false;
+    } // catch
+    
+    if(pBatch->mpVertices != nullptr)
+    {
+        pBatch->mnVAO   = GLU::VertexArrayGetVAO(pBatch->mpVertices);
+        pBatch->mnFirst = GLU::VertexArrayGetFirst(pBatch->mpVertices);
+    } // if
+    else
+    {
+        pBatch->m_Draws.clear();
+    } // else
+    
+    return bSuccess;
+} // GLUTextBatchBuild
+
+#pragma mark -
+#pragma mark Private - Utilities - Resolution
+
+// Screen pixels per point at the center of a text, from the height its
+// upper half projects to in the view
+static CGFloat GLUTextGetPixelsPerPoint(const GLU::TextRef pText)
+{
+    if((pText->m_Size.height <= 0.0f) || (pText->m_Bounds.size.height <= 0.0f))
+    {
+        return 0.0f;
+    } // if
+    
+    const matrix_float4x4 mvp = GLUTextBatchGetMVP(pText);
+    
+    // Non-perspective texts span [0, 1], and perspective texts [-1, 1]
+    const GLfloat nCenter = pText->mbOrtho2D ? 0.5f : 0.0f;
+    const GLfloat nHalf   = pText->mbOrtho2D ? 0.5f : 1.0f;
+    
+    const simd::float4 center = {nCenter, nCenter, 0.0f, 1.0f};
+    const simd::float4 top    = {nCenter, nCenter + nHalf, 0.0f, 1.0f};
+    
+    // Rows of the transformation are stored in its columns
+    const GLfloat nCenterW = simd::dot(mvp.columns[3], center);
+    const GLfloat nTopW    = simd::dot(mvp.columns[3], top);
+    
+    // Behind the eye
+    if((nCenterW <= 0.0f) || (nTopW <= 0.0f))
+    {
+        return 0.0f;
+    } // if
+    
+    const GLfloat nCenterY = simd::dot(mvp.columns[1], center) / nCenterW;
+    const GLfloat nTopY    = simd::dot(mvp.columns[1], top) / nTopW;
+    
+    // Normalized device coordinates span 2 over the height of the view
+    const CGFloat nPixels = 0.5f * std::fabs(nTopY - nCenterY) * pText->m_Bounds.size.height;
+    
+    return nPixels / (0.5f * pText->m_Size.height);
+} // GLUTextGetPixelsPerPoint
+
+// Screen pixels per point of a text, rounded up to a power of two, so its
+// glyphs are only re-rasterized when its zoom crosses one
+static CGFloat GLUTextGetScale(const GLU::TextRef pText)
+{
+    const CGFloat nPixels = GLUTextGetPixelsPerPoint(pText);
+    
+    return (nPixels > 0.0f) ? std::exp2(std::ceil(std::log2(nPixels))) : 0.0f;
+} // GLUTextGetScale
+
+// Re-rasterize the glyphs of a text on a worker thread when its scale on
+// screen changed their field size, showing the previous glyphs meanwhile
+static void GLUTextResolutionUpdate(GLU::TextRef pText)
+{
+    // Checked again once the string being laid out is shown
+    if(pText->mpJob != nullptr)
+    {
+        return;
+    } // if
+    
+    const CGFloat nScale = GLUTextGetScale(pText);
+    
+    if((nScale <= 0.0f) || (nScale == pText->mnScale))
+    {
+        return;
+    } // if
+    
+    // Texts of a string only change when the field size of their font does,
+    // and texts of an attributed string whenever their scale does
+    const bool bChanged = (pText->mnFontSize <= 0.0f)
+                       || (GLU::GlyphAtlasGetFieldSize(pText->mnFontSize * nScale)
+                           != GLU::GlyphAtlasGetFieldSize(pText->mnFontSize * pText->mnScale));
+    
+    // Not asked again until the scale changes, even if the layout fails
+    pText->mnScale = nScale;
+    
+    if(bChanged && ((pText->mpString != nullptr) || (pText->mpAttrString != nullptr)))
+    {
+        GLU::TextJob *pJob = GLUTextJobCreate(pText->mpString, pText->mpAttrString, pText);
+        
+        if(pJob != nullptr)
+        {
+            GLUTextJobQueue(pJob, pText);
+        } // if
+    } // if
+} // GLUTextResolutionUpdate
+
+// Lay out a text again once a reset of its atlas moved its glyphs.  It is
+// done at once, as the previous glyphs sample texels that were reused.
+static void GLUTextGenerationUpdate(GLU::TextRef pText)
+{
+    if((pText->mpAtlas == nullptr) || (pText->mnGeneration == GLU::GlyphAtlasGetGeneration(pText->mpAtlas)))
+    {
+        return;
+    } // if
+    
+    bool bSuccess = false;
+    
+    try
+    {
+        NSSize size = pText->m_Size;
+        
+        GLU::GlyphQuads quads;
+        
+        if(pText->mpAttrString != nullptr)
+        {
+            bSuccess = GLU::GlyphAtlasLayout(pText->mpAttrString, size, quads, pText->mnScale, pText->mpAtlas);
+        } // if
+        else if(pText->mpString != nullptr)
+        {
+            bSuccess = GLU::GlyphAtlasLayout(pText->mpString,
+                                             pText->mpFontName,
+                                             pText->mnFontSize,
+                                             pText->mnAlignment,
+                                             size,
+                                             quads,
+                                             pText->mnScale,
+                                             pText->mpAtlas);
+        } // else if
+        
+        bSuccess = bSuccess && GLUTextUpdateVertices(quads, size, pText);
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for laying out a text again: \"%s\"", ba.what());
+        
+        bSuccess = false;
+    } // catch
+    
+    if(!bSuccess)
+    {
+        NSLog(@">> ERROR: Failed laying out a text again after the glyph atlas was reset!");
+        
+        // Not asked again until the atlas is reset again
+        pText->mnGeneration = GLU::GlyphAtlasGetGeneration(pText->mpAtlas);
+    } // if
+} // GLUTextGenerationUpdate
+
+#pragma mark -
+#pragma mark Public - Utilities - Accessors
+
+// Specify how the red, green, blue, and alpha source and
+// destination blending factors are computed
+void GLU::TextSetBlending(const GLenum& rSrc,
+                          const GLenum& rDst,
+                          GLU::TextRef pText)
+{
+    if(pText != nullptr)
+    {
+        // Check the source and destination blending factors
+        GLenum nSFactor = GLUTextCheckBlending(rSrc) ? rSrc : GL_SRC_ALPHA;
+        GLenum nDFactor = GLUTextCheckBlending(rDst) ? rDst : GL_ONE;
+        
+        // Blend function source factor
+        pText->mnFactor[0] = nSFactor;
+        
+        // Blend function destination factor
+        pText->mnFactor[1] = nDFactor;
+    } // if
+} // GLTextSetBlending
+
+// Set field-of-view for prespective correct text
+void GLU::TextSetFieldOfView(const GLfloat& rFovy,
+                             GLU::TextRef pText)
+{
+    if(pText != nullptr)
+    {
+        GLfloat nFovy = rFovy * GLM::kRadians_f;
+        
+        if(nFovy != pText->m_Transform.mnFovy)
+        {
+            pText->m_Transform.mnFovy = nFovy;
+            
+            GLUTextTransformInvalidate(GLU::kTextDirtyProjection, pText);
+        } // if
+    } // if
+} // GLTextSetFieldOfView
+
+// Set the text zoom for perspective projection
+void GLU::TextSetZoom(const GLfloat& rDeltaY,
+                      GLU::TextRef pText)
+{
+    if(pText != nullptr)
+    {
+        GLfloat nZoom = pText->m_Transform.mnZoom + 0.01f * rDeltaY;
+        
+        if(nZoom < 0.05f)
+        {
+            nZoom = 0.05f;
+        } // if
+        else if(nZoom > 2.0f)
+        {
+            nZoom = 2.0f;
+        } // else if
+        
+        if(nZoom != pText->m_Transform.mnZoom)
+        {
+            pText->m_Transform.mnZoom = nZoom;
+            
+            GLUTextTransformInvalidate(GLU::kTextDirtyProjection, pText);
+        } // if
+    } // if
+} // GLTextSetZoom
+
+// Set the uniform assocated with a model-view-projection linear transformation.
+// Computed and uploaded when the text is next displayed.
+void GLU::TextSetMVP(const NSRect& rBounds,
+                     const vector_float3& rTranslate,
+                     const vector_float4& rRotate,
+                     GLU::TextRef pText)
+{
+    if(pText != nullptr)
+    {
+        GLUTextTransformSetMVP(rBounds, rTranslate, rRotate, pText);
+    } // if
+} // GLTextSetUniformMVP
+
+// Set the uniform assocated with a frustum linear transformation.  Only
+// invalidates the projection if the bounds or the projection changed.
+void GLU::TexSetPrespective(const NSRect& rBounds,
+                            GLU::TextRef pText)
+{
+    if(pText != nullptr)
+    {
+        bool bChanged = GLUTextSetBounds(rBounds, pText);
+        
+        if(pText->m_Transform.mnProjection != GLU::kTextProjectionFrustum)
+        {
+            pText->m_Transform.mnProjection = GLU::kTextProjectionFrustum;
+            
+            bChanged = true;
+        } // if
+        
+        if(bChanged)
+        {
+            GLUTextTransformInvalidate(GLU::kTextDirtyProjection, pText);
+        } // if
+    } // if
+} // GLTexSetPrespective
+
+// Set the uniform assocated with a orthographic 2D transformation
+void GLU::TextSetOrthographic(const NSRect& rBounds,
+                              GLU::TextRef pText)
+{
+    if((pText != nullptr) && GLUTextSetBounds(rBounds, pText))
+    {
+        GLUTextTransformInvalidate(GLU::kTextDirtyOrtho2D, pText);
+    } // if
+} // GLTextSetOrthographic
+
+#pragma mark -
+#pragma mark Public - Strings
+
+// Change the string of a text created from a string
+bool GLU::TextSetString(CFStringRef pString,
+                        GLU::TextRef pText)
+{
+    if((pText == nullptr) || (pString == nullptr))
+    {
+        return false;
+    } // if
+    
+    if(pText->mnFontSize <= 0.0f)
+    {
+        NSLog(@">> WARNING: Texts created from attributed strings are changed with TextSetAttributedString!");
+        
+        return false;
+    } // if
+    
+    // Strings laid out on worker threads would replace this one
+    GLUTextJobCancel(pText);
+    
+    bool bSuccess = false;
+    
+    try
+    {
+        GLU::String key = GLUTextCacheKey(pText->mbOrtho2D,
+                                          GLUTextCacheGetString(pString),
+                                          GLUTextCacheGetString(pText->mpFontName),
+                                          pText->mnFontSize,
+                                          pText->mnAlignment,
+                                          pText->mbColors ? pText->m_Colors : nullptr);
+        
+        // The same string changes nothing
+        if((pText->mpKey != nullptr) && (*pText->mpKey == key))
+        {
+            return true;
+        } // if
+        
+        NSSize size = pText->m_Size;
+        
+        GLU::GlyphQuads quads;
+        
+        bSuccess = GLU::GlyphAtlasLayout(pString,
+                                         pText->mpFontName,
+                                         pText->mnFontSize,
+                                         pText->mnAlignment,
+                                         size,
+                                         quads,
+                                         pText->mnScale,
+                                         pText->mpAtlas)
+                && GLUTextUpdateVertices(quads, size, pText);
+        
+        if(bSuccess)
+        {
+            GLUTextSetSource(pString, nullptr, pText);
+        } // if
+        
+        // Cached under the new string when the text is deleted
+        if(bSuccess && (pText->mpKey != nullptr))
+        {
+            *pText->mpKey = std::move(key);
+        } // if
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for changing the string of a text: \"%s\"", ba.what());
+        
+        bSuccess = false;
+    } // catch
+    
+    return bSuccess;
+} // GLUTextSetString
+
+// Change the string of a text created from a stl string
+bool GLU::TextSetString(const GLU::String& rString,
+                        GLU::TextRef pText)
+{
+    bool bSuccess = false;
+    
+    CFStringRef pString = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                    rString.c_str(),
+                                                    kCFStringEncodingUTF8);
+    
+    if(pString != nullptr)
+    {
+        bSuccess = GLU::TextSetString(pString, pText);
+        
+        CFRelease(pString);
+    } // if
+    
+    return bSuccess;
+} // GLUTextSetString
+
+// Change the attributed string of a text
+bool GLU::TextSetAttributedString(CFAttributedStringRef pAttrString,
+                                  GLU::TextRef pText)
+{
+    if((pText == nullptr) || (pAttrString == nullptr))
+    {
+        return false;
+    } // if
+    
+    GLUTextJobCancel(pText);
+    
+    bool bSuccess = false;
+    
+    try
+    {
+        NSSize size = pText->m_Size;
+        
+        GLU::GlyphQuads quads;
+        
+        bSuccess = GLU::GlyphAtlasLayout(pAttrString, size, quads, pText->mnScale, pText->mpAtlas)
+                && GLUTextUpdateVertices(quads, size, pText);
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for changing the string of a text: \"%s\"", ba.what());
+        
+        bSuccess = false;
+    } // catch
     
-    return bSuccess;
-} // GLUTextCheckBlending
-
-#pragma mark -
-#pragma mark Public - Utilities - Accessors
-
-// Specify how the red, green, blue, and alpha source and
-// destination blending factors are computed
-void GLU::TextSetBlending(const GLenum& rSrc,
-                          const GLenum& rDst,
-                          GLU::TextRef pText)
-{
-    if(pText != nullptr)
+    // Texts of attributed strings are not cached
+    if(bSuccess)
     {
-        // Check the source and destination blending factors
-        GLenum nSFactor = GLUTextCheckBlending(rSrc) ? rSrc : GL_SRC_ALPHA;
-        GLenum nDFactor = GLUTextCheckBlending(rDst) ? rDst : GL_ONE;
+        GLUTextSetSource(nullptr, pAttrString, pText);
         
-        // Blend function source factor
-        pText->mnFactor[0] = nSFactor;
+        delete pText->mpKey;
         
-        // Blend function destination factor
-        pText->mnFactor[1] = nDFactor;
+        pText->mpKey = nullptr;
     } // if
-} // GLTextSetBlending
+    
+    return bSuccess;
+} // GLUTextSetAttributedString
 
-// Set field-of-view for prespective correct text
-void GLU::TextSetFieldOfView(const GLfloat& rFovy,
+// Change the string of a text created from a string on a worker thread
+bool GLU::TextSetStringAsync(CFStringRef pString,
                              GLU::TextRef pText)
 {
-    if(pText != nullptr)
+    if((pText == nullptr) || (pString == nullptr))
     {
-        pText->m_Transform.mnFovy = rFovy * GLM::kRadians_f;
+        return false;
     } // if
-} // GLTextSetFieldOfView
-
-// Set the text zoom for perspective projection
-void GLU::TextSetZoom(const GLfloat& rDeltaY,
-                      GLU::TextRef pText)
-{
-    if(pText != nullptr)
+    
+    if(pText->mnFontSize <= 0.0f)
     {
-        pText->m_Transform.mnZoom += 0.01f * rDeltaY;
+        NSLog(@">> WARNING: Texts created from attributed strings are changed with TextSetAttributedStringAsync!");
         
-        if(pText->m_Transform.mnZoom < 0.05f)
-        {
-            pText->m_Transform.mnZoom = 0.05f;
-        } // if
-        else if(pText->m_Transform.mnZoom > 2.0f)
-        {
-            pText->m_Transform.mnZoom = 2.0f;
-        } // else if
+        return false;
     } // if
-} // GLTextSetZoom
-
-// Set the uniform assocated with a model-view-projection linear transformation
-void GLU::TextSetMVP(const NSRect& rBounds,
-                     const vector_float3& rTranslate,
-                     const vector_float4& rRotate,
-                     GLU::TextRef pText)
-{
-    if(pText != nullptr)
+    
+    GLU::TextJob *pJob = GLUTextJobCreate(pString, nullptr, pText);
+    
+    if(pJob == nullptr)
     {
-        // Compute the model-view-projection linear transformation
-        matrix_float4x4 mvp = GLUTextTransformCreateMVP(rBounds, rTranslate, rRotate, pText);
-        
-        // Enable the program object
-        glUseProgram(pText->m_Program.mnPID);
+        return false;
+    } // if
+    
+    // The same string, with no other pending, changes nothing
+    if((pText->mpJob == nullptr) && (pText->mpKey != nullptr) && (*pText->mpKey == pJob->m_Key))
+    {
+        GLUTextJobDelete(pJob);
         
-        // Update the mvp linear transformation
-        GLM::uniform(pText->m_Program.m_UID.mnMVP, false, mvp);
+        return true;
     } // if
-} // GLTextSetUniformMVP
+    
+    return GLUTextJobQueue(pJob, pText);
+} // GLUTextSetStringAsync
 
-// Set the uniform assocated with a frustum linear transformation
-void GLU::TexSetPrespective(const NSRect& rBounds,
-                            GLU::TextRef pText)
+// Change the string of a text created from a stl string on a worker thread
+bool GLU::TextSetStringAsync(const GLU::String& rString,
+                             GLU::TextRef pText)
 {
-    if(pText != nullptr)
+    bool bSuccess = false;
+    
+    CFStringRef pString = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                    rString.c_str(),
+                                                    kCFStringEncodingUTF8);
+    
+    if(pString != nullptr)
     {
-        // Compute the mvp linear transformation
-        matrix_float4x4 mvp = GLUTextTransformCreateMVP(rBounds, pText);
+        bSuccess = GLU::TextSetStringAsync(pString, pText);
         
-        // Update the projection matrix
-        glUseProgram(pText->m_Program.mnPID);
-        
-        // Set the mvp linear transformation unifrom
-        GLM::uniform(pText->m_Program.m_UID.mnMVP, false, mvp);
+        CFRelease(pString);
     } // if
-} // GLTexSetPrespective
+    
+    return bSuccess;
+} // GLUTextSetStringAsync
 
-// Set the uniform assocated with a orthographic 2D transformation
-void GLU::TextSetOrthographic(const NSRect& rBounds,
-                              GLU::TextRef pText)
+// Change the attributed string of a text on a worker thread
+bool GLU::TextSetAttributedStringAsync(CFAttributedStringRef pAttrString,
+                                       GLU::TextRef pText)
 {
-    if(pText != nullptr)
+    if((pText == nullptr) || (pAttrString == nullptr))
     {
-        // Calculate the orthographic 2D linear transformation
-        pText->m_Transform.m_Ortho2D = GLUTextTransformCreateOrtho2D(rBounds, pText);
-        
-        // Enable the program object
-        glUseProgram(pText->m_Program.mnPID);
-        
-        // Set the orthographic 2D linear transformation
-        glUniform4f(pText->m_Program.m_UID.mnMVP,
-                    pText->m_Transform.m_Ortho2D.x,
-                    pText->m_Transform.m_Ortho2D.y,
-                    pText->m_Transform.m_Ortho2D.z,
-                    pText->m_Transform.m_Ortho2D.w);
+        return false;
     } // if
-} // GLTextSetOrthographic
+    
+    GLU::TextJob *pJob = GLUTextJobCreate(nullptr, pAttrString, pText);
+    
+    return (pJob != nullptr) && GLUTextJobQueue(pJob, pText);
+} // GLUTextSetAttributedStringAsync
+
+// Commit the string of a text laid out on a worker thread, if it is done
+bool GLU::TextUpdate(GLU::TextRef pText)
+{
+    return (pText != nullptr) && GLUTextJobFinish(pText);
+} // GLUTextUpdate
+
+// Whether a string of a text is still laid out on a worker thread
+bool GLU::TextIsPending(const GLU::TextRef pText)
+{
+    return (pText != nullptr) && (pText->mpJob != nullptr);
+} // GLUTextIsPending
 
 #pragma mark -
 #pragma mark Public - Utilities - Rendering
@@ -762,24 +2676,111 @@ void GLU::TextDisplay(const GLU::TextRef pText)
 {
     if(pText != nullptr)
     {
+        GLU::TextDisplay(&pText, 1);
+    } // if
+} // GLTextDisplay
+
+// Render texts into an OpenGL view
+void GLU::TextDisplay(const GLU::TextRef * const pTexts,
+                      const GLuint& rCount)
+{
+    GLU::UniformArenaRef pArena = GLUTextUniformGetArena();
+    
+    if((pTexts != nullptr) && rCount && (pArena != nullptr))
+    {
+        // Take strings laid out on worker threads since the last frame,
+        // before the transformations they scale, and then lay out again
+        // the texts whose glyphs a reset of the atlas by them moved
+        for(GLuint i = 0; i < rCount; ++i)
+        {
+            if(pTexts[i] != nullptr)
+            {
+                GLUTextJobFinish(pTexts[i]);
+            } // if
+        } // for
+        
+        for(GLuint i = 0; i < rCount; ++i)
+        {
+            if(pTexts[i] != nullptr)
+            {
+                GLUTextGenerationUpdate(pTexts[i]);
+            } // if
+        } // for
+        
+        // Stage the transformations of all the texts and upload them
+        // with a single buffer update
+        GLU::UniformArenaReset(pArena);
+        
+        for(GLuint i = 0; i < rCount; ++i)
+        {
+            GLU::TextRef pText = pTexts[i];
+            
+            if(pText != nullptr)
+            {
+                // Recompute what changed since the last frame
+                GLUTextTransformUpdate(pText);
+                
+                // Re-rasterize glyphs zoomed across a power of two
+                GLUTextResolutionUpdate(pText);
+                
+                pText->mnOffset = GLU::UniformArenaAllocate(sizeof(GLU::TextBlock), pArena);
+                
+                GLvoid *pBlock = GLU::UniformArenaGetPointer(pText->mnOffset, pArena);
+                
+                if(pBlock != nullptr)
+                {
+                    std::memcpy(pBlock, &pText->m_Block, sizeof(GLU::TextBlock));
+                } // if
+            } // if
+        } // for
+        
+        GLU::UniformArenaCommit(pArena);
+        
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         
         glDisable(GL_DEPTH_TEST);
         glEnable(GL_BLEND);
         {
-            // Specify pixel arithmetic.
-            glBlendFunc(pText->mnFactor[0], pText->mnFactor[1]);
-            
             // Select both front and back-facing polygon rasterization
             glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
             
-            glUseProgram(pText->m_Program.mnPID);
-            glBindVertexArray(pText->m_Program.mnVAO);
-            
             glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, pText->mnTID);
             
-            glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+            // Texts of the same projection share their program object
+            GLuint nPID = 0;
+            
+            for(GLuint i = 0; i < rCount; ++i)
+            {
+                GLU::TextRef pText = pTexts[i];
+                
+                if(pText != nullptr)
+                {
+                    // Specify pixel arithmetic.
+                    glBlendFunc(pText->mnFactor[0], pText->mnFactor[1]);
+                    
+                    if(pText->m_Program.mnPID != nPID)
+                    {
+                        nPID = pText->m_Program.mnPID;
+                        
+                        glUseProgram(nPID);
+                    } // if
+                    
+                    glBindVertexArray(pText->m_Program.mnVAO);
+                    
+                    // Source the transforms from this text's block
+                    GLU::UniformArenaBind(pText->mnOffset, sizeof(GLU::TextBlock), pArena);
+                    
+                    // One draw per atlas page the glyphs sample
+                    for(GLuint j = 0; j < pText->mnRanges; ++j)
+                    {
+                        const GLU::TextRange& rRange = pText->mpRanges[j];
+                        
+                        glBindTexture(GL_TEXTURE_2D, rRange.mnTID);
+                        
+                        glDrawArrays(GL_TRIANGLES, pText->m_Program.mnFirst + rRange.mnFirst, rRange.mnCount);
+                    } // for
+                } // if
+            } // for
         }
         glDisable(GL_BLEND);
     } // if
@@ -806,17 +2807,28 @@ GLU::TextRef GLU::TextCreatePerspective(const GLU::String &rString,
         // Clear the sturcture
         GLUTextSetDefaults(pText);
         
-        if(!GLUTextCreateTexture2D(rString, rFontName, rFontSize, rAlignment, pText))
+        GLU::GlyphQuads quads;
+        
+        if(!GLUTextCacheAcquire(false, rString, rFontName, rFontSize, rAlignment, pColors, pText)
+           && !GLUTextLayout(rString, rFontName, rFontSize, rAlignment, quads, pText))
         {
-            throw @"Failed creating a texture 2d for a c-string";
+            GLUTextDeleteVertices(pText);
+            
+            throw @"Failed laying out the glyphs of a stl string";
         }
         
-        if(!GLUTextAcquirePerspective(rBounds, pColors, pText))
+        if(!GLUTextAcquirePerspective(rBounds, quads, pColors, pText))
         {
-            glDeleteTextures(1, &pText->mnTID);
+            GLUTextDeleteVertices(pText);
+            GLUTextReleaseProgram(pText);
             
             throw @"Failed acquiring a 2d perspective text";
         }
+        
+        // Kept for changing the string, see TextSetString
+        GLUTextSetFont(rFontName, rFontSize, rAlignment, pText);
+        
+        GLUTextSetSource(rString, pText);
     } // try
     catch(std::bad_alloc& ba)
     {
@@ -853,17 +2865,28 @@ GLU::TextRef GLU::TextCreateNonPerspective(const GLU::String& rString,
         // Clear the sturcture
         GLUTextSetDefaults(pText);
         
-        if(!GLUTextCreateTexture2D(rString, rFontName, rFontSize, rAlignment, pText))
+        GLU::GlyphQuads quads;
+        
+        if(!GLUTextCacheAcquire(true, rString, rFontName, rFontSize, rAlignment, pColors, pText)
+           && !GLUTextLayout(rString, rFontName, rFontSize, rAlignment, quads, pText))
         {
-            throw @"Failed creating a texture 2d for a c-string";
+            GLUTextDeleteVertices(pText);
+            
+            throw @"Failed laying out the glyphs of a stl string";
         }
         
-        if(!GLUTextAcquireNonPerspective(rBounds, rPosition, pColors, pText))
+        if(!GLUTextAcquireNonPerspective(rBounds, rPosition, quads, pColors, pText))
         {
-            glDeleteTextures(1, &pText->mnTID);
+            GLUTextDeleteVertices(pText);
+            GLUTextReleaseProgram(pText);
             
             throw @"Failed acquiring a 2d non-perspective text";
         }
+        
+        // Kept for changing the string, see TextSetString
+        GLUTextSetFont(rFontName, rFontSize, rAlignment, pText);
+        
+        GLUTextSetSource(rString, pText);
     } // try
     catch(std::bad_alloc& ba)
     {
@@ -897,17 +2920,28 @@ GLU::TextRef GLU::TextCreatePerspective(CFStringRef pString,
         // Clear the sturcture
         GLUTextSetDefaults(pText);
         
-        if(!GLUTextCreateTexture2D(pString, pFontName, rFontSize, rAlignment, pText))
+        GLU::GlyphQuads quads;
+        
+        if(!GLUTextCacheAcquire(false, pString, pFontName, rFontSize, rAlignment, pColors, pText)
+           && !GLUTextLayout(pString, pFontName, rFontSize, rAlignment, quads, pText))
         {
-            throw @"Failed creating a texture 2d for a c-string";
+            GLUTextDeleteVertices(pText);
+            
+            throw @"Failed laying out the glyphs of a core foundation string";
         }
         
-        if(!GLUTextAcquirePerspective(rBounds, pColors, pText))
+        if(!GLUTextAcquirePerspective(rBounds, quads, pColors, pText))
         {
-            glDeleteTextures(1, &pText->mnTID);
+            GLUTextDeleteVertices(pText);
+            GLUTextReleaseProgram(pText);
             
             throw @"Failed acquiring a 2d perspective text";
         }
+        
+        // Kept for changing the string, see TextSetString
+        GLUTextSetFont(pFontName, rFontSize, rAlignment, pText);
+        
+        GLUTextSetSource(pString, nullptr, pText);
     } // try
     catch(std::bad_alloc& ba)
     {
@@ -944,17 +2978,28 @@ GLU::TextRef GLU::TextCreateNonPerspective(CFStringRef pString,
         // Clear the sturcture
         GLUTextSetDefaults(pText);
         
-        if(!GLUTextCreateTexture2D(pString, pFontName, rFontSize, rAlignment, pText))
+        GLU::GlyphQuads quads;
+        
+        if(!GLUTextCacheAcquire(true, pString, pFontName, rFontSize, rAlignment, pColors, pText)
+           && !GLUTextLayout(pString, pFontName, rFontSize, rAlignment, quads, pText))
         {
-            throw @"Failed creating a texture 2d for a c-string";
+            GLUTextDeleteVertices(pText);
+            
+            throw @"Failed laying out the glyphs of a core foundation string";
         }
         
-        if(!GLUTextAcquireNonPerspective(rBounds, rPosition, pColors, pText))
+        if(!GLUTextAcquireNonPerspective(rBounds, rPosition, quads, pColors, pText))
         {
-            glDeleteTextures(1, &pText->mnTID);
+            GLUTextDeleteVertices(pText);
+            GLUTextReleaseProgram(pText);
             
             throw @"Failed acquiring a 2d non-perspective text";
         }
+        
+        // Kept for changing the string, see TextSetString
+        GLUTextSetFont(pFontName, rFontSize, rAlignment, pText);
+        
+        GLUTextSetSource(pString, nullptr, pText);
     } // try
     catch(std::bad_alloc& ba)
     {
@@ -987,17 +3032,23 @@ GLU::TextRef GLU::TextCreatePerspective(CFAttributedStringRef pAttrString,
         // Clear the sturcture
         GLUTextSetDefaults(pText);
         
-        if(!GLUTextCreateTexture2D(pAttrString, pText))
+        GLU::GlyphQuads quads;
+        
+        if(!GLUTextLayout(pAttrString, quads, pText))
         {
-            throw @"Failed creating a texture 2d for a c-string";
+            throw @"Failed laying out the glyphs of an attributed string";
         }
         
-        if(!GLUTextAcquirePerspective(rBounds, pColors, pText))
+        if(!GLUTextAcquirePerspective(rBounds, quads, pColors, pText))
         {
-            glDeleteTextures(1, &pText->mnTID);
+            GLUTextDeleteVertices(pText);
+            GLUTextReleaseProgram(pText);
             
             throw @"Failed acquiring a 2d perspective text";
         }
+        
+        // Kept for laying out again at a new scale
+        GLUTextSetSource(nullptr, pAttrString, pText);
     } // try
     catch(std::bad_alloc& ba)
     {
@@ -1031,17 +3082,23 @@ GLU::TextRef GLU::TextCreateNonPerspective(CFAttributedStringRef pAttrString,
         // Clear the sturcture
         GLUTextSetDefaults(pText);
         
-        if(!GLUTextCreateTexture2D(pAttrString, pText))
+        GLU::GlyphQuads quads;
+        
+        if(!GLUTextLayout(pAttrString, quads, pText))
         {
-            throw @"Failed creating a texture 2d for a c-string";
+            throw @"Failed laying out the glyphs of an attributed string";
         }
         
-        if(!GLUTextAcquireNonPerspective(rBounds, rPosition, pColors, pText))
+        if(!GLUTextAcquireNonPerspective(rBounds, rPosition, quads, pColors, pText))
         {
-            glDeleteTextures(1, &pText->mnTID);
+            GLUTextDeleteVertices(pText);
+            GLUTextReleaseProgram(pText);
             
             throw @"Failed acquiring a 2d perspective text";
         }
+        
+        // Kept for laying out again at a new scale
+        GLUTextSetSource(nullptr, pAttrString, pText);
     } // try
     catch(std::bad_alloc& ba)
     {
@@ -1067,11 +3124,339 @@ void GLU::TextDelete(GLU::TextRef pText)
 {
     if(pText != nullptr)
     {
-        glDeleteTextures(1, &pText->mnTID);
+        // Wait for the worker threads to be done with the atlas
+        GLUTextJobCancel(pText);
+        
+        // Keep the vertices for a text created again, if they fit
+        if(!GLUTextCacheRelease(pText))
+        {
+            GLUTextDeleteVertices(pText);
+        } // if
+        
+        if(pText->mpFontName != nullptr)
+        {
+            CFRelease(pText->mpFontName);
+        } // if
+        
+        GLUTextSetSource(nullptr, nullptr, pText);
+        
+        GLU::VertexLayoutDelete(pText->m_Program.mpLayout);
+        GLU::ProgramRelease(pText->m_Program.mpProgram);
         
-        GLU::VertexArrayDelete(pText->mpVertices);
-        GLU::ProgramDelete(pText->m_Program.mpProgram);
+        GLUTextUniformDisableTransforms();
         
         delete pText;
     } // if
 } // GLUTextDelete
+
+#pragma mark -
+#pragma mark Public - Cache
+
+// Set the budget of every text cache in GPU bytes.  The least recently
+// deleted vertices beyond it are evicted from the cache of the current
+// share group now, and from the others when they next take vertices.
+void GLU::TextCacheSetBudget(const GLsizeiptr& rBytes)
+{
+    GLU::gTextCacheBudget = (rBytes > 0) ? rBytes : 0;
+    
+    for(auto& rCache : GLU::gTextCaches)
+    {
+        rCache.second.mnBudget = GLU::gTextCacheBudget;
+    } // for
+    
+    GLU::TextCache *pCache = GLUTextCacheGet();
+    
+    if(pCache != nullptr)
+    {
+        GLUTextCacheEvict(pCache->mnBudget, *pCache);
+    } // if
+} // GLUTextCacheSetBudget
+
+// Get the counters of the text cache of the current share group
+GLU::TextCacheStats GLU::TextCacheGetStats()
+{
+    GLU::TextCacheStats stats = {0, 0, 0, 0, 0, GLU::gTextCacheBudget};
+    
+    const GLU::TextCache *pCache = GLUTextCacheGet();
+    
+    if(pCache != nullptr)
+    {
+        stats.mnHits      = pCache->mnHits;
+        stats.mnMisses    = pCache->mnMisses;
+        stats.mnEvictions = pCache->mnEvictions;
+        stats.mnEntries   = GLuint(pCache->m_Entries.size());
+        stats.mnBytes     = pCache->mnBytes;
+        stats.mnBudget    = pCache->mnBudget;
+    } // if
+    
+    return stats;
+} // GLUTextCacheGetStats
+
+// Delete every cached vertices of the current share group, without
+// counting them as evictions
+void GLU::TextCachePurge()
+{
+    auto pIter = GLU::gTextCaches.find(CGLGetShareGroup(CGLGetCurrentContext()));
+    
+    if(pIter != GLU::gTextCaches.end())
+    {
+        for(GLU::TextCacheEntry& rEntry : pIter->second.m_Entries)
+        {
+            GLUTextCacheEntryDelete(rEntry);
+        } // for
+        
+        GLU::gTextCaches.erase(pIter);
+    } // if
+} // GLUTextCachePurge
+
+#pragma mark -
+#pragma mark Public - Batch
+
+// Create a batch of texts drawn by a single program
+GLU::TextBatchRef GLU::TextBatchCreate()
+{
+    GLU::TextBatchRef pBatch = nullptr;
+    
+    try
+    {
+        pBatch = new GLU::TextBatch;
+        
+        pBatch->mbDirty    = false;
+        pBatch->mnPID      = 0;
+        pBatch->mnVAO      = 0;
+        pBatch->mnFirst    = 0;
+        pBatch->mpProgram  = nullptr;
+        pBatch->mpLayout   = nullptr;
+        pBatch->mpVertices = nullptr;
+        
+        pBatch->m_Slots.reserve(GLU::kTextBatchCapacity);
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for a text batch: \"%s\"", ba.what());
+        
+        delete pBatch;
+        
+        return nullptr;
+    } // catch
+    
+    if(!GLUTextBatchAcquireProgram(pBatch))
+    {
+        NSLog(@">> ERROR: Failed acquiring a program for a text batch!");
+        
+        GLU::VertexLayoutDelete(pBatch->mpLayout);
+        GLU::ProgramRelease(pBatch->mpProgram);
+        
+        delete pBatch;
+        
+        return nullptr;
+    } // if
+    
+    if(!GLUTextUniformEnableTransforms(pBatch->mnPID))
+    {
+        NSLog(@">> ERROR: Failed sourcing the transforms of a text batch!");
+        
+        GLU::VertexLayoutDelete(pBatch->mpLayout);
+        GLU::ProgramRelease(pBatch->mpProgram);
+        
+        delete pBatch;
+        
+        return nullptr;
+    } // if
+    
+    return pBatch;
+} // GLUTextBatchCreate
+
+// Delete the batch, its program, and its vertices
+void GLU::TextBatchDelete(GLU::TextBatchRef pBatch)
+{
+    if(pBatch != nullptr)
+    {
+        GLU::VertexArrayDelete(pBatch->mpVertices);
+        GLU::VertexLayoutDelete(pBatch->mpLayout);
+        GLU::ProgramRelease(pBatch->mpProgram);
+        
+        GLUTextUniformDisableTransforms();
+        
+        delete pBatch;
+    } // if
+} // GLUTextBatchDelete
+
+// Add a text to the batch
+bool GLU::TextBatchAdd(GLU::TextRef pText,
+                       GLU::TextBatchRef pBatch)
+{
+    if((pText == nullptr) || (pBatch == nullptr))
+    {
+        return false;
+    } // if
+    
+    for(const GLU::TextBatchSlot& rSlot : pBatch->m_Slots)
+    {
+        if(rSlot.mpText == pText)
+        {
+            return true;
+        } // if
+    } // for
+    
+    if(pBatch->m_Slots.size() == GLU::kTextBatchCapacity)
+    {
+        NSLog(@">> WARNING: A text batch is full, with %u texts!", GLU::kTextBatchCapacity);
+        
+        return false;
+    } // if
+    
+    pBatch->m_Slots.push_back({pText, {pText->mnFactor[0], pText->mnFactor[1]}, pText->mnRevision});
+    
+    pBatch->mbDirty = true;
+    
+    return true;
+} // GLUTextBatchAdd
+
+// Remove a text from the batch
+void GLU::TextBatchRemove(const GLU::TextRef pText,
+                          GLU::TextBatchRef pBatch)
+{
+    if(pBatch != nullptr)
+    {
+        for(auto pIter = pBatch->m_Slots.begin(); pIter != pBatch->m_Slots.end(); ++pIter)
+        {
+            if(pIter->mpText == pText)
+            {
+                pBatch->m_Slots.erase(pIter);
+                
+                pBatch->mbDirty = true;
+                
+                break;
+            } // if
+        } // for
+    } // if
+} // GLUTextBatchRemove
+
+// Remove every text from the batch
+void GLU::TextBatchClear(GLU::TextBatchRef pBatch)
+{
+    if((pBatch != nullptr) && !pBatch->m_Slots.empty())
+    {
+        pBatch->m_Slots.clear();
+        
+        pBatch->mbDirty = true;
+    } // if
+} // GLUTextBatchClear
+
+// Render the texts of the batch, with a draw call per blending factors and
+// atlas page, and without clearing the framebuffer
+void GLU::TextBatchDisplay(GLU::TextBatchRef pBatch)
+{
+    GLU::UniformArenaRef pArena = GLUTextUniformGetArena();
+    
+    if((pBatch == nullptr) || (pArena == nullptr))
+    {
+        return;
+    } // if
+    
+    // Blending factors set, or strings changed, since the batch was built
+    // rebuild it
+    for(GLU::TextBatchSlot& rSlot : pBatch->m_Slots)
+    {
+        GLUTextJobFinish(rSlot.mpText);
+    } // for
+    
+    for(GLU::TextBatchSlot& rSlot : pBatch->m_Slots)
+    {
+        // Glyphs moved by a reset of the atlas are laid out again
+        GLUTextGenerationUpdate(rSlot.mpText);
+        
+        if((rSlot.mnFactor[0] != rSlot.mpText->mnFactor[0]) || (rSlot.mnFactor[1] != rSlot.mpText->mnFactor[1]))
+        {
+            rSlot.mnFactor[0] = rSlot.mpText->mnFactor[0];
+            rSlot.mnFactor[1] = rSlot.mpText->mnFactor[1];
+            
+            pBatch->mbDirty = true;
+        } // if
+        
+        if(rSlot.mnRevision != rSlot.mpText->mnRevision)
+        {
+            rSlot.mnRevision = rSlot.mpText->mnRevision;
+            
+            pBatch->mbDirty = true;
+        } // if
+    } // for
+    
+    if(pBatch->mbDirty)
+    {
+        pBatch->mbDirty = !GLUTextBatchBuild(pBatch);
+    } // if
+    
+    if(pBatch->m_Draws.empty())
+    {
+        return;
+    } // if
+    
+    // Stage the transformations of all the texts in one block
+    GLU::UniformArenaReset(pArena);
+    
+    const GLintptr nOffset = GLU::UniformArenaAllocate(sizeof(GLU::TextBatchBlock), pArena);
+    
+    GLubyte *pBlock = static_cast<GLubyte *>(GLU::UniformArenaGetPointer(nOffset, pArena));
+    
+    if(pBlock == nullptr)
+    {
+        return;
+    } // if
+    
+    for(const GLU::TextBatchSlot& rSlot : pBatch->m_Slots)
+    {
+        // Recompute what changed since the last frame
+        GLUTextTransformUpdate(rSlot.mpText);
+        
+        GLUTextResolutionUpdate(rSlot.mpText);
+        
+        const matrix_float4x4 mvp = GLUTextBatchGetMVP(rSlot.mpText);
+        
+        std::memcpy(pBlock, &mvp, sizeof(matrix_float4x4));
+        
+        pBlock += sizeof(matrix_float4x4);
+    } // for
+    
+    GLU::UniformArenaCommit(pArena);
+    
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    {
+        // Select both front and back-facing polygon rasterization
+        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        
+        glActiveTexture(GL_TEXTURE0);
+        
+        glUseProgram(pBatch->mnPID);
+        glBindVertexArray(pBatch->mnVAO);
+        
+        GLU::UniformArenaBind(nOffset, sizeof(GLU::TextBatchBlock), pArena);
+        
+        // Only change the state that differs from the previous draw
+        GLenum nFactor[2] = {GL_NONE, GL_NONE};
+        GLuint nTID       = 0;
+        
+        for(const GLU::TextBatchDraw& rDraw : pBatch->m_Draws)
+        {
+            if((rDraw.mnFactor[0] != nFactor[0]) || (rDraw.mnFactor[1] != nFactor[1]))
+            {
+                nFactor[0] = rDraw.mnFactor[0];
+                nFactor[1] = rDraw.mnFactor[1];
+                
+                glBlendFunc(nFactor[0], nFactor[1]);
+            } // if
+            
+            if(rDraw.mnTID != nTID)
+            {
+                nTID = rDraw.mnTID;
+                
+                glBindTexture(GL_TEXTURE_2D, nTID);
+            } // if
+            
+            glDrawArrays(GL_TRIANGLES, pBatch->mnFirst + rDraw.mnFirst, rDraw.mnCount);
+        } // for
+    }
+    glDisable(GL_BLEND);
+} // GLUTextBatchDisplay
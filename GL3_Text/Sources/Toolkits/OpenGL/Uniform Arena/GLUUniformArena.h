@@ -0,0 +1,65 @@
+/*
+     File: GLUUniformArena.h
+ Abstract:
+ Utility toolkit for staging uniform blocks in a per-frame arena.
+
+ Objects allocate a std140 block each in the arena, write their uniforms into
+ it, and the whole frame is uploaded to a single uniform buffer with one
+ buffer update.  Each draw then sources its block with glBindBufferRange
+ instead of issuing glUniform* calls.
+
+ */
+
+// MacOS X
+
+#ifndef _GL_UTILITIES_UNIFORM_ARENA_H_
+#define _GL_UTILITIES_UNIFORM_ARENA_H_
+
+// OpenGL Mac OS X
+#import <OpenGL/OpenGL.h>
+
+#ifdef __cplusplus
+
+namespace GLU
+{
+    // Opaque data reference to a uniform arena, see GLUVertexArray.h
+    typedef struct UniformArena *UniformArenaRef;
+
+    // Create an arena whose uniform buffer is bound at the given uniform
+    // buffer binding point, with an initial capacity in bytes.  The arena
+    // grows as needed.
+    UniformArenaRef UniformArenaCreate(const GLuint& rBinding,
+                                       const GLsizeiptr& rCapacity);
+
+    // Delete the arena and its uniform buffer
+    void UniformArenaDelete(UniformArenaRef pArena);
+
+    // Source the named uniform block of a program from the arena
+    bool UniformArenaAttach(const GLuint& rProgramID,
+                            const GLchar * const pBlock,
+                            const UniformArenaRef pArena);
+
+    // Discard the blocks staged for the previous frame
+    void UniformArenaReset(UniformArenaRef pArena);
+
+    // Reserve a block, aligned for glBindBufferRange, and return its offset,
+    // or -1 if the arena could not grow
+    GLintptr UniformArenaAllocate(const GLsizeiptr& rSize,
+                                  UniformArenaRef pArena);
+
+    // Address of a staged block.  Valid until the next allocation.
+    GLvoid *UniformArenaGetPointer(const GLintptr& rOffset,
+                                   UniformArenaRef pArena);
+
+    // Upload every block staged since the last reset with one buffer update
+    void UniformArenaCommit(UniformArenaRef pArena);
+
+    // Source the attached uniform blocks from a committed block
+    void UniformArenaBind(const GLintptr& rOffset,
+                          const GLsizeiptr& rSize,
+                          const UniformArenaRef pArena);
+} // GLU
+
+#endif
+
+#endif
@@ -0,0 +1,231 @@
+/*
+     File: GLUUniformArena.mm
+ Abstract:
+ Utility toolkit for staging uniform blocks in a per-frame arena.
+
+ */
+
+#pragma mark -
+#pragma mark Headers
+
+// STL container types and algorithms
+#import <algorithm>
+#import <vector>
+
+// Mac OS X frameworks
+#import <Cocoa/Cocoa.h>
+
+// OpenGL core profile
+#import <OpenGL/gl3.h>
+
+// OpenGL uniform arena header
+#import "GLUUniformArena.h"
+
+#pragma mark -
+#pragma mark Private - Data Structures
+
+namespace GLU
+{
+    struct UniformArena
+    {
+        GLuint      mnBID;          // Uniform buffer object
+        GLuint      mnBinding;      // Uniform buffer binding point
+        GLsizeiptr  mnAlignment;    // Offset alignment for glBindBufferRange
+        GLsizeiptr  mnSize;         // Bytes staged for the current frame
+        GLsizeiptr  mnCapacity;     // Size of the uniform buffer data store
+
+        std::vector<GLubyte>  m_Staging;
+    }; // UniformArena
+
+    typedef struct UniformArena  UniformArena;
+} // GLU
+
+#pragma mark -
+#pragma mark Private - Utilities
+
+// Round up to a multiple of the uniform buffer offset alignment
+static GLsizeiptr GLUUniformArenaAlign(const GLsizeiptr& rSize,
+                                       const GLU::UniformArenaRef pArena)
+{
+    const GLsizeiptr nAlignment = pArena->mnAlignment;
+
+    return (rSize + nAlignment - 1) / nAlignment * nAlignment;
+} // GLUUniformArenaAlign
+
+// Grow the staging store to hold at least the given number of bytes
+static bool GLUUniformArenaReserve(const GLsizeiptr& rSize,
+                                   GLU::UniformArenaRef pArena)
+{
+    GLsizeiptr nSize = GLsizeiptr(pArena->m_Staging.size());
+
+    if(rSize > nSize)
+    {
+        try
+        {
+            pArena->m_Staging.resize(std::max(rSize, 2 * nSize));
+        } // try
+        catch(std::bad_alloc& ba)
+        {
+            NSLog(@">> ERROR: Failed allocating memory for uniform arena backing store: \"%s\"", ba.what());
+
+            return false;
+        } // catch
+    } // if
+
+    return true;
+} // GLUUniformArenaReserve
+
+#pragma mark -
+#pragma mark Public - Constructor
+
+// Create an arena whose uniform buffer is bound at the binding point
+GLU::UniformArenaRef GLU::UniformArenaCreate(const GLuint& rBinding,
+                                             const GLsizeiptr& rCapacity)
+{
+    GLU::UniformArenaRef pArena = nullptr;
+
+    try
+    {
+        pArena = new GLU::UniformArena;
+
+        GLint nAlignment = 0;
+
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &nAlignment);
+
+        pArena->mnBinding   = rBinding;
+        pArena->mnAlignment = (nAlignment > 0) ? nAlignment : 256;
+        pArena->mnSize      = 0;
+        pArena->mnCapacity  = 0;
+        pArena->mnBID       = 0;
+
+        pArena->m_Staging.resize(GLUUniformArenaAlign(std::max(rCapacity, GLsizeiptr(1)), pArena));
+
+        glGenBuffers(1, &pArena->mnBID);
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for uniform arena backing store: \"%s\"", ba.what());
+
+        delete pArena;
+
+        pArena = nullptr;
+    } // catch
+
+    return pArena;
+} // GLUUniformArenaCreate
+
+#pragma mark -
+#pragma mark Public - Destructor
+
+// Delete the arena and its uniform buffer
+void GLU::UniformArenaDelete(GLU::UniformArenaRef pArena)
+{
+    if(pArena != nullptr)
+    {
+        glDeleteBuffers(1, &pArena->mnBID);
+
+        delete pArena;
+    } // if
+} // GLUUniformArenaDelete
+
+#pragma mark -
+#pragma mark Public - Programs
+
+// Source the named uniform block of a program from the arena
+bool GLU::UniformArenaAttach(const GLuint& rProgramID,
+                             const GLchar * const pBlock,
+                             const GLU::UniformArenaRef pArena)
+{
+    bool bSuccess = rProgramID && pBlock && pArena;
+
+    if(bSuccess)
+    {
+        GLuint nIndex = glGetUniformBlockIndex(rProgramID, pBlock);
+
+        bSuccess = nIndex != GL_INVALID_INDEX;
+
+        if(bSuccess)
+        {
+            glUniformBlockBinding(rProgramID, nIndex, pArena->mnBinding);
+        } // if
+        else
+        {
+            NSLog(@">> ERROR: Program %u has no uniform block \"%s\"", rProgramID, pBlock);
+        } // else
+    } // if
+
+    return bSuccess;
+} // GLUUniformArenaAttach
+
+#pragma mark -
+#pragma mark Public - Staging
+
+// Discard the blocks staged for the previous frame
+void GLU::UniformArenaReset(GLU::UniformArenaRef pArena)
+{
+    if(pArena != nullptr)
+    {
+        pArena->mnSize = 0;
+    } // if
+} // GLUUniformArenaReset
+
+// Reserve an aligned block and return its offset
+GLintptr GLU::UniformArenaAllocate(const GLsizeiptr& rSize,
+                                   GLU::UniformArenaRef pArena)
+{
+    GLintptr nOffset = -1;
+
+    if((pArena != nullptr) && (rSize > 0))
+    {
+        GLsizeiptr nStart = GLUUniformArenaAlign(pArena->mnSize, pArena);
+        GLsizeiptr nEnd   = nStart + rSize;
+
+        if(GLUUniformArenaReserve(nEnd, pArena))
+        {
+            pArena->mnSize = nEnd;
+
+            nOffset = nStart;
+        } // if
+    } // if
+
+    return nOffset;
+} // GLUUniformArenaAllocate
+
+// Address of a staged block
+GLvoid *GLU::UniformArenaGetPointer(const GLintptr& rOffset,
+                                    GLU::UniformArenaRef pArena)
+{
+    return ((pArena != nullptr) && (rOffset >= 0)) ? &pArena->m_Staging[rOffset] : nullptr;
+} // GLUUniformArenaGetPointer
+
+#pragma mark -
+#pragma mark Public - Upload
+
+// Upload every block staged since the last reset with one buffer update
+void GLU::UniformArenaCommit(GLU::UniformArenaRef pArena)
+{
+    if((pArena != nullptr) && pArena->mnSize)
+    {
+        pArena->mnCapacity = GLsizeiptr(pArena->m_Staging.size());
+
+        glBindBuffer(GL_UNIFORM_BUFFER, pArena->mnBID);
+
+        // Orphan the data store, so draws from the previous frame that may
+        // still be reading it do not stall the update
+        glBufferData(GL_UNIFORM_BUFFER, pArena->mnCapacity, nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, pArena->mnSize, pArena->m_Staging.data());
+
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    } // if
+} // GLUUniformArenaCommit
+
+// Source the attached uniform blocks from a committed block
+void GLU::UniformArenaBind(const GLintptr& rOffset,
+                           const GLsizeiptr& rSize,
+                           const GLU::UniformArenaRef pArena)
+{
+    if((pArena != nullptr) && (rOffset >= 0))
+    {
+        glBindBufferRange(GL_UNIFORM_BUFFER, pArena->mnBinding, pArena->mnBID, rOffset, rSize);
+    } // if
+} // GLUUniformArenaBind
@@ -55,6 +55,9 @@
 // OpenGL interleaved array utilities
 #import "GLUArray.h"
 
+// OpenGL vertex attribute layouts
+#import "GLUVertexLayout.h"
+
 #ifdef __cplusplus
 
 namespace GLU
@@ -68,6 +71,13 @@ namespace GLU
     // opaque data reference.
     typedef struct VertexArray *VertexArrayRef;
     
+    // Create a vao from a vertex layout and an interleaved array of the
+    // same layout.  Makes no attribute queries.  Vertices are converted to
+    // the layout's attribute types, see GLUVertexLayout.h.
+    VertexArrayRef VertexArrayCreate(const VertexLayoutRef pLayout,
+                                     const GLuint& rCount,
+                                     const ArrayRef pArray);
+    
     // Create a vao, representing a 2D object, using vertices, colors,
     // and texture coordinates
     VertexArrayRef VertexArrayCreate(const GLuint& rProgramID,
@@ -87,6 +97,10 @@ namespace GLU
                                      const GLchar * const pColor,
                                      const ArrayRef pArray);
     
+    // Create VAO representing a quad, from a 2D vertex layout
+    VertexArrayRef VertexArrayCreateQuad(const VertexLayoutRef pLayout,
+                                         const GLfloat * const pColors);
+    
     // Create VAO representing a quad
     VertexArrayRef VertexArrayCreateQuad(const GLuint& rProgramID,
                                          const GLchar  * const pColor,
@@ -103,15 +117,72 @@ namespace GLU
     // Delete the VAO opaque data reference
     void VertexArrayDelete(VertexArrayRef pVertexArray);
     
-    // Get VBO id
+    // Delete the vao, keeping the vertices.  A vao is only valid in the
+    // context that created it, which must be current.
+    void VertexArrayDetach(VertexArrayRef pVertexArray);
+    
+    // Create a vao in the current context for the vertices of a detached
+    // vertex array, made in a context of the same share group.  Instance
+    // attributes must be set again.
+    bool VertexArrayAttach(const VertexLayoutRef pLayout,
+                           VertexArrayRef pVertexArray);
+    
+    // Update rCount vertices of the vao, from the first, with the same
+    // vertices of an interleaved array of the vertex layout.  Returns false,
+    // leaving the vao unchanged, if they are not all in the vao.
+    bool VertexArrayUpdate(const VertexLayoutRef pLayout,
+                           const GLuint& rFirst,
+                           const GLuint& rCount,
+                           const ArrayRef pArray,
+                           VertexArrayRef pVertexArray);
+    
+    // Get VBO id.  Small vertex arrays share a VBO suballocated by
+    // stride, see GLUBufferPool.h.
     const GLuint VertexArrayGetBuffer(const VertexArrayRef pVertexArray);
     
+    // Get the first vertex in the VBO, the first index to draw from
+    const GLuint VertexArrayGetFirst(const VertexArrayRef pVertexArray);
+    
     // Get VAO id
     const GLuint VertexArrayGetVAO(const VertexArrayRef pVertexArray);
     
-    // Get the cached attribute location
-    const GLuint VertexArrayGetLocation(const GLchar * const pName,
-                                        const VertexArrayRef pVertexArray);
+    // Get the location of an attribute, or -1 if it is not enabled
+    const GLint VertexArrayGetLocation(const ArrayAttribute& rAttribute,
+                                       const VertexArrayRef pVertexArray);
+    
+    // Add a buffer of rCapacity instances, of rStride bytes each, to the vao
+    // and return its index, or -1 on failure.  Instance data may be given,
+    // or null to be updated later.
+    GLint VertexArrayAddInstances(const GLsizei& rStride,
+                                  const GLuint& rCapacity,
+                                  const GLvoid * const pInstances,
+                                  VertexArrayRef pVertexArray);
+    
+    // Source an attribute from an instance buffer, advancing every
+    // rDivisor instances.  Attributes of more than 4 components, such as a
+    // 4x4 matrix of 16 floats, take consecutive locations of 4 components.
+    bool VertexArraySetInstanceAttribute(const GLint& rInstances,
+                                         const GLint& rLocation,
+                                         const GLint& rSize,
+                                         const GLenum& rType,
+                                         const GLboolean& rNormalized,
+                                         const GLsizeiptr& rOffset,
+                                         const GLuint& rDivisor,
+                                         VertexArrayRef pVertexArray);
+    
+    // Update rCount instances of an instance buffer, from the first.
+    // Replacing every instance orphans the buffer rather than waiting on
+    // draws still reading it.
+    void VertexArrayUpdateInstances(const GLint& rInstances,
+                                    const GLuint& rFirst,
+                                    const GLuint& rCount,
+                                    const GLvoid * const pInstances,
+                                    const VertexArrayRef pVertexArray);
+    
+    // Draw rInstances instances of the vertices in a single call
+    void VertexArrayDrawInstanced(const GLenum& rMode,
+                                  const GLsizei& rInstances,
+                                  const VertexArrayRef pVertexArray);
 } // GLU
 
 #endif
@@ -50,9 +50,17 @@
 #pragma mark -
 #pragma mark Headers
 
-// STL container types
-#import <string>
-#import <unordered_map>
+// STL container types and algorithms
+#import <algorithm>
+#import <map>
+#import <utility>
+#import <vector>
+
+// Mac OS X frameworks
+#import <Cocoa/Cocoa.h>
+
+// OpenGL share groups
+#import <OpenGL/OpenGL.h>
 
 // OpenGL core profile
 #import <OpenGL/gl3.h>
@@ -60,6 +68,9 @@
 // OpenGL vertices private type
 #import "GLUVertices.h"
 
+// OpenGL buffer suballocation
+#import "GLUBufferPool.h"
+
 // OpenGL VAO header
 #import "GLUVertexArray.h"
 
@@ -68,8 +79,15 @@
 
 namespace GLU
 {
-    // Name associated with an attribute or a binding point
-    typedef std::string  Name;
+    // Buffer of per-instance attributes
+    struct VertexArrayInstances
+    {
+        GLuint   mnBID;
+        GLsizei  mnStride;      // Bytes per instance
+        GLuint   mnCapacity;    // Instances in the buffer
+    }; // VertexArrayInstances
+    
+    typedef struct VertexArrayInstances  VertexArrayInstances;
     
     // Interleaved array
     struct VertexArray
@@ -78,21 +96,46 @@ namespace GLU
         GLuint mnBID;
         GLuint mnPID;
         GLuint mnCount;
+        GLuint mnFirst;         // First vertex in the buffer
+        GLsizei mnStride;       // Bytes per vertex
+        bool   mbPooled;        // Vertices suballocated from a shared buffer
+        
+        CGLShareGroupObj  mpShareGroup;     // Share group of the pool
+        
+        BufferRange  m_Range;
+        
+        GLint  mnLocation[kVertexAttributes];   // From the vertex layout
         
-        std::unordered_map<Name, GLuint>  m_Attributes;
+        std::vector<VertexArrayInstances>  m_Instances;
     }; // GLUVertexArray
     
     typedef struct VertexArray  VertexArray;
+    
+    // Shared buffer pool for a vertex stride
+    struct VertexArrayPool
+    {
+        BufferPoolRef  mpPool;
+        GLuint         mnCount;     // Vertex arrays using the pool
+    }; // VertexArrayPool
+    
+    typedef struct VertexArrayPool  VertexArrayPool;
+    
+    // Buffer names are only valid in the share group that created them
+    typedef std::pair<CGLShareGroupObj, GLsizei>  VertexArrayPoolKey;
+    
+    // Buffer pools of the vertex arrays, by share group and stride.  Each is
+    // deleted with the last vertex array using it.
+    static std::map<VertexArrayPoolKey, VertexArrayPool>  gVertexArrayPools;
 } // GLU
 
 #pragma mark -
-#pragma mark Private - Utilities - Buffers
+#pragma mark Private - Constants
 
-// Get a pointer into a buffer at an offset
-static const GLchar *GLUBufferGetOffset(const GLsizeiptr nOffset)
-{
-    return((const GLchar *)nullptr + nOffset);
-} // GLUBufferGetOffset
+// Vertices per pool slab, larger arrays get a buffer of their own
+static const GLuint kVertexArrayPoolCapacity = 16384;
+
+#pragma mark -
+#pragma mark Private - Utilities - Buffers
 
 // Create a buffer
 static GLuint GLUBufferCreate(const GLenum& rTarget,
@@ -117,30 +160,6 @@ static GLuint GLUBufferCreate(const GLenum& rTarget,
 #pragma mark -
 #pragma mark Private - Utilities - Arrays
 
-// Enable a generic vertex attribute
-static BOOL GLUVertexAttributeArrayEnable(const GLint& rSize,
-                                          const GLchar * const pName,
-                                          const GLsizei& rStride,
-                                          const GLvoid *pOffset,
-                                          GLU::VertexArrayRef pVertexArray)
-{
-    BOOL bSuccess = pName != nullptr;
-    
-    if(bSuccess)
-    {
-        glUseProgram(pVertexArray->mnPID);
-        
-        const GLint nAttribLoc = glGetAttribLocation(pVertexArray->mnPID, pName);
-        
-        pVertexArray->m_Attributes[pName] = nAttribLoc;
-        
-        glVertexAttribPointer(nAttribLoc, rSize, GL_FLOAT, GL_FALSE, rStride, pOffset);
-        glEnableVertexAttribArray(nAttribLoc);
-    } // if
-    
-    return bSuccess;
-} // GLUVertexAttributeArrayEnable
-
 // Create an array buffer
 static GLuint GLUArrayBufferCreate(const GLuint& rCount,
                                    const GLuint& rSPP,
@@ -160,96 +179,192 @@ static void GLUArrayBufferBind(const GLuint nBID)
 #pragma mark -
 #pragma mark Private - Utilities - Vertices
 
-// Get a float array from a STL vector representing a 2D object
+// Get a float array from an interleaved array
 static const GLfloat * GLUArrayGetPointer(const GLU::ArrayRef pArray)
 {
-    return((const GLfloat *)&pArray->m_Vertices[0]);
+    return((const GLfloat *)pArray->mpVertices);
 } // GLUArrayGetPointer
 
 #pragma mark -
-#pragma mark Private - Utilities - Vertex Array
+#pragma mark Private - Utilities - Pools
 
-// Create a buffer for vertices of a triangle fan
-static void GLUVertexArrayEnable(const GLchar * const pPosition,
-                                 const GLchar * const pTexCoord,
-                                 const GLchar * const pColor,
-                                 const GLU::ArrayRef pArray,
-                                 GLU::VertexArrayRef pVertexArray)
+// Suballocate the vertices from the shared pool of their stride, in the
+// share group of the current context
+static bool GLUVertexArrayPoolAcquire(const GLsizei& rStride,
+                                      const GLvoid * const pVertices,
+                                      GLU::VertexArrayRef pVertexArray)
 {
-    GLsizei nStride = sizeof(GLU::Vertex);
+    if(pVertexArray->mnCount > kVertexArrayPoolCapacity)
+    {
+        return false;
+    } // if
     
-    pVertexArray->mnBID = GLUArrayBufferCreate(pVertexArray->mnCount, nStride, GLUArrayGetPointer(pArray));
+    CGLShareGroupObj pShareGroup = CGLGetShareGroup(CGLGetCurrentContext());
     
-    GLsizeiptr nOffsetTexCoord = sizeof(vector_float2);
-    GLsizeiptr nOffsetColor    = 2 * nOffsetTexCoord;
+    try
+    {
+        GLU::VertexArrayPool& rPool = GLU::gVertexArrayPools[GLU::VertexArrayPoolKey(pShareGroup, rStride)];
+        
+        if(rPool.mpPool == nullptr)
+        {
+            rPool.mpPool  = GLU::BufferPoolCreate(rStride, kVertexArrayPoolCapacity);
+            rPool.mnCount = 0;
+        } // if
+        
+        if(!GLU::BufferPoolAllocate(pVertexArray->mnCount, pVertexArray->m_Range, rPool.mpPool))
+        {
+            return false;
+        } // if
+        
+        GLU::BufferPoolUpload(pVertexArray->m_Range, pVertexArray->mnCount, pVertices, rPool.mpPool);
+        
+        rPool.mnCount++;
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for vertex array pool: \"%s\"", ba.what());
+        
+        return false;
+    } // catch
     
-    GLUArrayBufferBind(pVertexArray->mnBID);
+    pVertexArray->mnBID    = pVertexArray->m_Range.mnBID;
+    pVertexArray->mnFirst  = pVertexArray->m_Range.mnFirst;
+    pVertexArray->mbPooled = true;
     
-    if(pPosition != nullptr)
-    {
-        GLUVertexAttributeArrayEnable(2, pPosition, nStride, GLUBufferGetOffset(0), pVertexArray);
-    } // if
+    pVertexArray->mpShareGroup = pShareGroup;
+    
+    return true;
+} // GLUVertexArrayPoolAcquire
+
+// Return the vertices to the pool, deleting it with its last vertex array
+static void GLUVertexArrayPoolRelease(const GLsizei& rStride,
+                                      GLU::VertexArrayRef pVertexArray)
+{
+    auto pIter = GLU::gVertexArrayPools.find(GLU::VertexArrayPoolKey(pVertexArray->mpShareGroup, rStride));
     
-    if(pTexCoord != nullptr)
+    if(pIter != GLU::gVertexArrayPools.end())
     {
-        GLUVertexAttributeArrayEnable(2, pTexCoord, nStride, GLUBufferGetOffset(nOffsetTexCoord), pVertexArray);
+        GLU::VertexArrayPool& rPool = pIter->second;
+        
+        GLU::BufferPoolFree(pVertexArray->m_Range, rPool.mpPool);
+        
+        if(--rPool.mnCount == 0)
+        {
+            GLU::BufferPoolDelete(rPool.mpPool);
+            GLU::gVertexArrayPools.erase(pIter);
+        } // if
     } // if
-    
-    if(pColor != nullptr)
+} // GLUVertexArrayPoolRelease
+
+// Source the vertices from a pool, or from a buffer of their own when
+// they do not fit a slab
+static void GLUVertexArrayBufferCreate(const GLvoid * const pVertices,
+                                       GLU::VertexArrayRef pVertexArray)
+{
+    if(!GLUVertexArrayPoolAcquire(pVertexArray->mnStride, pVertices, pVertexArray))
     {
-        GLUVertexAttributeArrayEnable(4, pColor, nStride, GLUBufferGetOffset(nOffsetColor), pVertexArray);
+        pVertexArray->mnBID   = GLUArrayBufferCreate(pVertexArray->mnCount, pVertexArray->mnStride, (const GLfloat *)pVertices);
+        pVertexArray->mnFirst = 0;
     } // if
-} // GLUVertexArrayEnable
-
-// Create a buffer for vertices of a triangle fan
-static void GLUVertexArrayEnable(const GLchar * const pPosition,
-                                 const GLchar * const pNormal,
-                                 const GLchar * const pTexCoord,
-                                 const GLchar * const pColor,
-                                 const GLU::ArrayRef pArray,
-                                 GLU::VertexArrayRef pVertexArray)
+} // GLUVertexArrayBufferCreate
+
+// Source the vertices of an interleaved array, converted to the attribute
+// types of a vertex layout
+static void GLUVertexArrayBufferCreate(const GLU::VertexLayoutRef pLayout,
+                                       const GLU::ArrayRef pArray,
+                                       GLU::VertexArrayRef pVertexArray)
 {
-    GLsizei nStride = sizeof(GLU::Vertex);
-    
-    pVertexArray->mnBID = GLUArrayBufferCreate(pVertexArray->mnCount, nStride, GLUArrayGetPointer(pArray));
-    
-    GLsizeiptr nOffsetNormals  = sizeof(vector_float3);
-    GLsizeiptr nOffsetTexCoord = 2 * nOffsetNormals;
-    GLsizeiptr nOffsetColor    = 3 * nOffsetNormals;
-    
-    GLUArrayBufferBind(pVertexArray->mnBID);
-    
-    if(pPosition != nullptr)
+    if(pVertexArray->mnStride == pArray->mnStride)
     {
-        GLUVertexAttributeArrayEnable(3, pPosition, nStride, GLUBufferGetOffset(0), pVertexArray);
+        GLUVertexArrayBufferCreate(GLUArrayGetPointer(pArray), pVertexArray);
     } // if
+    else
+    {
+        std::vector<GLubyte> vertices(GLsizeiptr(pVertexArray->mnCount) * pVertexArray->mnStride);
+
+        GLU::VertexLayoutPack(pArray, pVertexArray->mnCount, vertices.data(), pLayout);
+
+        GLUVertexArrayBufferCreate(vertices.data(), pVertexArray);
+    } // else
+} // GLUVertexArrayBufferCreate
+
+#pragma mark -
+#pragma mark Private - Utilities - Vertex Array
+
+// Create a vao and buffer for an interleaved array, with the attribute
+// locations and types of a vertex layout
+static GLU::VertexArrayRef GLUVertexArrayCreate(const GLU::VertexLayoutRef pLayout,
+                                                const GLuint& rCount,
+                                                const GLU::ArrayRef pArray)
+{
+    GLU::VertexArrayRef pVertexArray = nullptr;
     
-    if(pNormal != nullptr)
+    if((pLayout == nullptr) || (pArray == nullptr))
     {
-        GLUVertexAttributeArrayEnable(3, pNormal, nStride, GLUBufferGetOffset(nOffsetNormals), pVertexArray);
+        return pVertexArray;
     } // if
     
-    if(pTexCoord != nullptr)
+    if(GLU::VertexLayoutGetArrayLayout(pLayout) != GLU::ArrayGetLayout(pArray))
     {
-        GLUVertexAttributeArrayEnable(3, pTexCoord, nStride, GLUBufferGetOffset(nOffsetTexCoord), pVertexArray);
+        NSLog(@">> ERROR: Interleaved array layout does not match the vertex layout!");
+        
+        return pVertexArray;
     } // if
     
-    if(pColor != nullptr)
+    try
     {
-        GLUVertexAttributeArrayEnable(4, pColor, nStride, GLUBufferGetOffset(nOffsetColor), pVertexArray);
-    } // if
-} // GLUVertexArrayEnable
-
-// Get the cached attribute location
-static GLuint GLUVertexArrayGetAttribute(const GLU::Name &rName,
-                                         GLU::VertexArrayRef pVertexArray)
-{
-    return pVertexArray->m_Attributes[rName];
-} // GLUVertexArrayGetLocation
+        pVertexArray = new GLU::VertexArray;
+        
+        pVertexArray->mnPID    = GLU::VertexLayoutGetProgram(pLayout);
+        pVertexArray->mnCount  = std::min(rCount, GLU::ArrayGetCount(pArray));
+        pVertexArray->mnStride = GLU::VertexLayoutGetStride(pLayout);
+        pVertexArray->mnBID    = 0;
+        pVertexArray->mnFirst  = 0;
+        pVertexArray->mbPooled = false;
+        
+        pVertexArray->mpShareGroup = nullptr;
+        
+        for(GLuint i = 0; i < GLU::kVertexAttributes; ++i)
+        {
+            pVertexArray->mnLocation[i] = GLU::VertexLayoutGetLocation(GLU::ArrayAttribute(i), pLayout);
+        } // for
+        
+        glGenVertexArrays(1, &pVertexArray->mnVAO);
+        
+        if(pVertexArray->mnVAO)
+        {
+            glBindVertexArray(pVertexArray->mnVAO);
+            
+            GLUVertexArrayBufferCreate(pLayout, pArray, pVertexArray);
+            
+            GLUArrayBufferBind(pVertexArray->mnBID);
+            
+            // Pooled vertices are addressed from the first vertex, so the
+            // attributes start at the beginning of the buffer
+            GLU::VertexLayoutEnable(0, pLayout);
+        } // if
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for vertex array backing store: \"%s\"", ba.what());
+        
+        pVertexArray = nullptr;
+    } // catch
+    
+    return pVertexArray;
+} // GLUVertexArrayCreate
 
 #pragma mark -
 #pragma mark Public - Constructors
 
+// Create a vao from a vertex layout and an interleaved array
+GLU::VertexArrayRef GLU::VertexArrayCreate(const GLU::VertexLayoutRef pLayout,
+                                           const GLuint& rCount,
+                                           const GLU::ArrayRef pArray)
+{
+    return GLUVertexArrayCreate(pLayout, rCount, pArray);
+} // GLUVertexArrayCreate
+
 // Create a vao, representing a 2D object, using vertices, colors,
 // and texture coordinates
 GLU::VertexArrayRef GLU::VertexArrayCreate(const GLuint& rProgramID,
@@ -263,30 +378,16 @@ GLU::VertexArrayRef GLU::VertexArrayCreate(const GLuint& rProgramID,
     
     if(rProgramID && pArray)
     {
-        try
-        {
-            pVertexArray = new GLU::VertexArray;
-            
-            pVertexArray->mnPID   = rProgramID;
-            pVertexArray->mnCount = rCount;
-            
-            glGenVertexArrays(1, &pVertexArray->mnVAO);
-            
-            if(pVertexArray->mnVAO)
-            {
-                glBindVertexArray(pVertexArray->mnVAO);
-                
-                GLUVertexArrayEnable(pPosition,
-                                     pTexCoord,
-                                     pColor,
-                                     pArray,
-                                     pVertexArray);
-            } // if
-        } // try
-        catch(std::bad_alloc& ba)
-        {
-            NSLog(@">> ERROR: Failed allocating memory for CF mutable dictionary backing store: \"%s\"", ba.what());
-        } // catch
+        GLU::VertexLayoutRef pLayout = GLU::VertexLayoutCreate(rProgramID,
+                                                               GLU::ArrayGetLayout(pArray),
+                                                               pPosition,
+                                                               nullptr,
+                                                               pTexCoord,
+                                                               pColor);
+        
+        pVertexArray = GLUVertexArrayCreate(pLayout, rCount, pArray);
+        
+        GLU::VertexLayoutDelete(pLayout);
     } // if
     
     return pVertexArray;
@@ -306,33 +407,16 @@ GLU::VertexArrayRef GLU::VertexArrayCreate(const GLuint& rProgramID,
     
     if(rProgramID && pArray)
     {
-        try
-        {
-            pVertexArray = new GLU::VertexArray;
-            
-            pVertexArray->mnPID   = rProgramID;
-            pVertexArray->mnCount = rCount;
-            
-            glGenVertexArrays(1, &pVertexArray->mnVAO);
-            
-            if(pVertexArray->mnVAO)
-            {
-                glBindVertexArray(pVertexArray->mnVAO);
-                
-                GLUVertexArrayEnable(pPosition,
-                                     pNormal,
-                                     pTexCoord,
-                                     pColor,
-                                     pArray,
-                                     pVertexArray);
-            } // if
-        } // try
-        catch(std::bad_alloc& ba)
-        {
-            NSLog(@">> ERROR: Failed allocating memory for vertex array backing store: \"%s\"", ba.what());
-            
-            return;
-        } // catch
+        GLU::VertexLayoutRef pLayout = GLU::VertexLayoutCreate(rProgramID,
+                                                               GLU::ArrayGetLayout(pArray),
+                                                               pPosition,
+                                                               pNormal,
+                                                               pTexCoord,
+                                                               pColor);
+        
+        pVertexArray = GLUVertexArrayCreate(pLayout, rCount, pArray);
+        
+        GLU::VertexLayoutDelete(pLayout);
     } // if
     
     return pVertexArray;
@@ -346,15 +430,126 @@ void GLU::VertexArrayDelete(GLU::VertexArrayRef pVertexArray)
 {
     if(pVertexArray != nullptr)
     {
-        pVertexArray->m_Attributes.clear();
+        if(pVertexArray->mbPooled)
+        {
+            GLUVertexArrayPoolRelease(pVertexArray->mnStride, pVertexArray);
+        } // if
+        else
+        {
+            glDeleteBuffers(1, &pVertexArray->mnBID);
+        } // else
+        
+        for(GLU::VertexArrayInstances& rInstances : pVertexArray->m_Instances)
+        {
+            glDeleteBuffers(1, &rInstances.mnBID);
+        } // for
         
-        glDeleteBuffers(1, &pVertexArray->mnBID);
         glDeleteVertexArrays(1, &pVertexArray->mnVAO);
         
         delete pVertexArray;
     } // if
 } // GLUVertexArrayDelete
 
+#pragma mark -
+#pragma mark Public - Contexts
+
+// Delete the vao of the context that created it, keeping the vertices
+void GLU::VertexArrayDetach(GLU::VertexArrayRef pVertexArray)
+{
+    if((pVertexArray != nullptr) && pVertexArray->mnVAO)
+    {
+        glDeleteVertexArrays(1, &pVertexArray->mnVAO);
+        
+        pVertexArray->mnVAO = 0;
+    } // if
+} // GLUVertexArrayDetach
+
+// Create a vao in the current context for the vertices of a detached vertex
+// array
+bool GLU::VertexArrayAttach(const GLU::VertexLayoutRef pLayout,
+                            GLU::VertexArrayRef pVertexArray)
+{
+    if((pLayout == nullptr) || (pVertexArray == nullptr) || pVertexArray->mnVAO)
+    {
+        return false;
+    } // if
+    
+    glGenVertexArrays(1, &pVertexArray->mnVAO);
+    
+    if(pVertexArray->mnVAO)
+    {
+        glBindVertexArray(pVertexArray->mnVAO);
+        
+        GLUArrayBufferBind(pVertexArray->mnBID);
+        
+        // Pooled vertices are addressed from the first vertex, so the
+        // attributes start at the beginning of the buffer
+        GLU::VertexLayoutEnable(0, pLayout);
+    } // if
+    
+    return pVertexArray->mnVAO != 0;
+} // GLUVertexArrayAttach
+
+#pragma mark -
+#pragma mark Public - Updates
+
+// Update a range of vertices in place, converted to the layout's attribute
+// types.  Vertices before the range are converted too, as conversion starts
+// from the first vertex of the array, but only the range is uploaded.
+bool GLU::VertexArrayUpdate(const GLU::VertexLayoutRef pLayout,
+                            const GLuint& rFirst,
+                            const GLuint& rCount,
+                            const GLU::ArrayRef pArray,
+                            GLU::VertexArrayRef pVertexArray)
+{
+    if((pLayout == nullptr) || (pArray == nullptr) || (pVertexArray == nullptr))
+    {
+        return false;
+    } // if
+    
+    const GLuint nCount = rFirst + rCount;
+    
+    if((nCount > pVertexArray->mnCount) || (nCount > GLU::ArrayGetCount(pArray))
+       || (GLU::VertexLayoutGetStride(pLayout) != pVertexArray->mnStride))
+    {
+        return false;
+    } // if
+    
+    if(!rCount)
+    {
+        return true;
+    } // if
+    
+    const GLsizei nStride = pVertexArray->mnStride;
+    
+    try
+    {
+        std::vector<GLubyte> vertices(GLsizeiptr(nCount) * nStride);
+        
+        if(!GLU::VertexLayoutPack(pArray, nCount, vertices.data(), pLayout))
+        {
+            return false;
+        } // if
+        
+        GLUArrayBufferBind(pVertexArray->mnBID);
+        
+        glBufferSubData(GL_ARRAY_BUFFER,
+                        GLintptr(pVertexArray->mnFirst + rFirst) * nStride,
+                        GLsizeiptr(rCount) * nStride,
+                        vertices.data() + GLsizeiptr(rFirst) * nStride);
+        
+        GLUArrayBufferBind(0);
+    } // try
+    catch(std::bad_alloc& ba)
+    {
+        NSLog(@">> ERROR: Failed allocating memory for updating vertices: \"%s\"", ba.what());
+        
+        return false;
+    } // catch
+    
+    return true;
+} // GLUVertexArrayUpdate
+
 #pragma mark -
 #pragma mark Public - Accessors
 
@@ -364,25 +559,31 @@ const GLuint GLU::VertexArrayGetBuffer(const GLU::VertexArrayRef pVertexArray)
     return pVertexArray->mnBID;
 } // GLUVertexArrayGetBuffer
 
+// Get the first vertex in the VBO
+const GLuint GLU::VertexArrayGetFirst(const GLU::VertexArrayRef pVertexArray)
+{
+    return pVertexArray->mnFirst;
+} // GLUVertexArrayGetFirst
+
 // Get VAO id
 const GLuint GLU::VertexArrayGetVAO(const GLU::VertexArrayRef pVertexArray)
 {
     return pVertexArray->mnVAO;
 } // GLUVertexArrayGetVAO
 
-// Get the named attribute location
-const GLuint GLU::VertexArrayGetLocation(const GLchar * const pName,
-                                         const GLU::VertexArrayRef pVertexArray)
+// Get the location of an attribute
+const GLint GLU::VertexArrayGetLocation(const GLU::ArrayAttribute& rAttribute,
+                                        const GLU::VertexArrayRef pVertexArray)
 {
-    return GLUVertexArrayGetAttribute(pName, pVertexArray);
+    return pVertexArray->mnLocation[rAttribute];
 } // GLUVertexArrayGetLocation
 
-// Create VAO representing a quad
-GLU::VertexArrayRef GLU::VertexArrayCreateQuad(const GLuint& rProgramID,
-                                               const GLchar  * const pVertex,
-                                               const GLchar  * const pColor,
-                                               const GLfloat * const pColors,
-                                               const GLchar  * const pTexCoords)
+#pragma mark -
+#pragma mark Public - Quads
+
+// Create VAO representing a quad, from a 2D vertex layout
+GLU::VertexArrayRef GLU::VertexArrayCreateQuad(const GLU::VertexLayoutRef pLayout,
+                                               const GLfloat * const pColors)
 {
     GLU::VertexArrayRef pVertexArray = nullptr;
     
@@ -390,12 +591,7 @@ GLU::VertexArrayRef GLU::VertexArrayCreateQuad(const GLuint& rProgramID,
     
     if(pVertices != nullptr)
     {
-        pVertexArray = GLU::VertexArrayCreate(rProgramID,
-                                              4,
-                                              pVertex,
-                                              pTexCoords,
-                                              pColor,
-                                              pVertices);
+        pVertexArray = GLUVertexArrayCreate(pLayout, 4, pVertices);
         
         GLU::ArrayDelete(pVertices);
     } // if
@@ -405,25 +601,172 @@ GLU::VertexArrayRef GLU::VertexArrayCreateQuad(const GLuint& rProgramID,
 
 // Create VAO representing a quad
 GLU::VertexArrayRef GLU::VertexArrayCreateQuad(const GLuint& rProgramID,
+                                               const GLchar  * const pVertex,
                                                const GLchar  * const pColor,
                                                const GLfloat * const pColors,
                                                const GLchar  * const pTexCoords)
 {
-    GLU::VertexArrayRef pVertexArray = nullptr;
+    GLU::VertexLayoutRef pLayout = GLU::VertexLayoutCreate(rProgramID,
+                                                           GLU::kArrayLayout2D,
+                                                           pVertex,
+                                                           nullptr,
+                                                           pTexCoords,
+                                                           pColor);
     
-    GLU::ArrayRef pVertices = GLU::ArrayCreateQuad(nullptr, nullptr, pColors);
+    GLU::VertexArrayRef pVertexArray = GLU::VertexArrayCreateQuad(pLayout, pColors);
     
-    if(pVertices != nullptr)
+    GLU::VertexLayoutDelete(pLayout);
+    
+    return pVertexArray;
+} // GLUVertexArrayCreateQuad
+
+// Create VAO representing a quad
+GLU::VertexArrayRef GLU::VertexArrayCreateQuad(const GLuint& rProgramID,
+                                               const GLchar  * const pColor,
+                                               const GLfloat * const pColors,
+                                               const GLchar  * const pTexCoords)
+{
+    return GLU::VertexArrayCreateQuad(rProgramID, nullptr, pColor, pColors, pTexCoords);
+} // GLUVertexArrayCreateQuad
+
+#pragma mark -
+#pragma mark Public - Instancing
+
+// Add a buffer of per-instance attributes to the vao
+GLint GLU::VertexArrayAddInstances(const GLsizei& rStride,
+                                   const GLuint& rCapacity,
+                                   const GLvoid * const pInstances,
+                                   GLU::VertexArrayRef pVertexArray)
+{
+    GLint nIndex = -1;
+    
+    if((pVertexArray != nullptr) && (rStride > 0) && rCapacity)
     {
-        pVertexArray = GLU::VertexArrayCreate(rProgramID,
-                                              4,
-                                              nullptr,
-                                              pTexCoords,
-                                              pColor,
-                                              pVertices);
+        GLU::VertexArrayInstances instances;
         
-        GLU::ArrayDelete(pVertices);
+        instances.mnStride   = rStride;
+        instances.mnCapacity = rCapacity;
+        instances.mnBID      = GLUBufferCreate(GL_ARRAY_BUFFER,
+                                               GL_DYNAMIC_DRAW,
+                                               GLsizeiptr(rCapacity) * rStride,
+                                               (const GLfloat *)pInstances);
+        
+        if(instances.mnBID)
+        {
+            try
+            {
+                pVertexArray->m_Instances.push_back(instances);
+                
+                nIndex = GLint(pVertexArray->m_Instances.size()) - 1;
+            } // try
+            catch(std::bad_alloc& ba)
+            {
+                NSLog(@">> ERROR: Failed allocating memory for vertex array instances: \"%s\"", ba.what());
+                
+                glDeleteBuffers(1, &instances.mnBID);
+            } // catch
+        } // if
     } // if
     
-    return pVertexArray;
-} // GLUVertexArrayCreateQuad
+    return nIndex;
+} // GLUVertexArrayAddInstances
+
+// Source an attribute from an instance buffer
+bool GLU::VertexArraySetInstanceAttribute(const GLint& rInstances,
+                                          const GLint& rLocation,
+                                          const GLint& rSize,
+                                          const GLenum& rType,
+                                          const GLboolean& rNormalized,
+                                          const GLsizeiptr& rOffset,
+                                          const GLuint& rDivisor,
+                                          GLU::VertexArrayRef pVertexArray)
+{
+    if((pVertexArray == nullptr) || (rLocation < 0) || (rSize <= 0))
+    {
+        return false;
+    } // if
+    
+    if((rInstances < 0) || (rInstances >= GLint(pVertexArray->m_Instances.size())))
+    {
+        NSLog(@">> ERROR: Vertex array has no instance buffer %d!", rInstances);
+        
+        return false;
+    } // if
+    
+    const GLU::VertexArrayInstances& rBuffer = pVertexArray->m_Instances[rInstances];
+    
+    // Bytes per component, for the columns of wide attributes
+    const GLsizeiptr nComponent = ((rType == GL_HALF_FLOAT) || (rType == GL_SHORT) || (rType == GL_UNSIGNED_SHORT)) ? 2
+                                : ((rType == GL_BYTE) || (rType == GL_UNSIGNED_BYTE)) ? 1
+                                : 4;
+    
+    glBindVertexArray(pVertexArray->mnVAO);
+    
+    GLUArrayBufferBind(rBuffer.mnBID);
+    
+    for(GLint nColumn = 0; (4 * nColumn) < rSize; ++nColumn)
+    {
+        const GLuint nLocation = GLuint(rLocation + nColumn);
+        const GLint  nSize     = std::min(rSize - 4 * nColumn, 4);
+        
+        const GLchar *pOffset = (const GLchar *)nullptr + rOffset + 4 * nColumn * nComponent;
+        
+        glVertexAttribPointer(nLocation, nSize, rType, rNormalized, rBuffer.mnStride, pOffset);
+        glVertexAttribDivisor(nLocation, rDivisor);
+        glEnableVertexAttribArray(nLocation);
+    } // for
+    
+    glBindVertexArray(0);
+    
+    return true;
+} // GLUVertexArraySetInstanceAttribute
+
+// Update instances of an instance buffer
+void GLU::VertexArrayUpdateInstances(const GLint& rInstances,
+                                     const GLuint& rFirst,
+                                     const GLuint& rCount,
+                                     const GLvoid * const pInstances,
+                                     const GLU::VertexArrayRef pVertexArray)
+{
+    if((pVertexArray != nullptr) && (pInstances != nullptr) && rCount
+       && (rInstances >= 0) && (rInstances < GLint(pVertexArray->m_Instances.size())))
+    {
+        const GLU::VertexArrayInstances& rBuffer = pVertexArray->m_Instances[rInstances];
+        
+        if(rFirst < rBuffer.mnCapacity)
+        {
+            const GLuint nCount = std::min(rCount, rBuffer.mnCapacity - rFirst);
+            
+            GLUArrayBufferBind(rBuffer.mnBID);
+            
+            if(!rFirst && (nCount == rBuffer.mnCapacity))
+            {
+                glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(nCount) * rBuffer.mnStride, pInstances, GL_DYNAMIC_DRAW);
+            } // if
+            else
+            {
+                glBufferSubData(GL_ARRAY_BUFFER,
+                                GLintptr(rFirst) * rBuffer.mnStride,
+                                GLsizeiptr(nCount) * rBuffer.mnStride,
+                                pInstances);
+            } // else
+            
+            GLUArrayBufferBind(0);
+        } // if
+    } // if
+} // GLUVertexArrayUpdateInstances
+
+// Draw instances of the vertices in a single call
+void GLU::VertexArrayDrawInstanced(const GLenum& rMode,
+                                   const GLsizei& rInstances,
+                                   const GLU::VertexArrayRef pVertexArray)
+{
+    if((pVertexArray != nullptr) && (rInstances > 0))
+    {
+        glBindVertexArray(pVertexArray->mnVAO);
+        
+        glDrawArraysInstanced(rMode, GLint(pVertexArray->mnFirst), GLsizei(pVertexArray->mnCount), rInstances);
+        
+        glBindVertexArray(0);
+    } // if
+} // GLUVertexArrayDrawInstanced
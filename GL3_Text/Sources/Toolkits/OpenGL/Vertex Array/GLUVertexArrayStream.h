@@ -0,0 +1,91 @@
+/*
+     File: GLUVertexArrayStream.h
+ Abstract:
+ Utility toolkit for streaming dynamic geometry through a ring buffer.
+
+ The vertex buffer is split into per-frame regions.  Each frame appends its
+ vertices to the next region with unsynchronized glMapBufferRange writes,
+ and ends with a fence.  A region is only waited on when the ring wraps
+ around to it, so geometry that changes every frame is drawn without
+ allocating buffers or stalling on draws still in flight.
+
+ */
+
+// MacOS X
+
+#ifndef _GL_UTILITIES_VERTEX_ARRAY_STREAM_H_
+#define _GL_UTILITIES_VERTEX_ARRAY_STREAM_H_
+
+// OpenGL interleaved array utilities
+#import "GLUArray.h"
+
+// OpenGL vertex attribute layouts
+#import "GLUVertexLayout.h"
+
+#ifdef __cplusplus
+
+namespace GLU
+{
+    // Opaque data reference to a vertex array stream, see GLUVertexArray.h
+    typedef struct VertexArrayStream *VertexArrayStreamRef;
+
+    // Create a stream of vertices for a vertex layout, with a ring buffer of
+    // rCapacity bytes, and a vao sourcing the layout's attributes from it
+    VertexArrayStreamRef VertexArrayStreamCreate(const VertexLayoutRef pLayout,
+                                                 const GLsizeiptr& rCapacity);
+
+    // Create a stream of vertices in the given layout, with a ring buffer of
+    // rCapacity bytes, and a vao sourcing the named attributes from it.
+    // Names may be null for attributes the program does not use.
+    VertexArrayStreamRef VertexArrayStreamCreate(const GLuint& rProgramID,
+                                                 const ArrayLayout& rLayout,
+                                                 const GLsizeiptr& rCapacity,
+                                                 const GLchar * const pPosition,
+                                                 const GLchar * const pNormal,
+                                                 const GLchar * const pTexCoord,
+                                                 const GLchar * const pColor);
+
+    // Delete the stream, its fences, buffer, and vao
+    void VertexArrayStreamDelete(VertexArrayStreamRef pStream);
+
+    // Start a frame in the next region of the ring, waiting only if the
+    // draws that last used that region have not completed
+    void VertexArrayStreamBegin(VertexArrayStreamRef pStream);
+
+    // Fence the draws of the frame
+    void VertexArrayStreamEnd(VertexArrayStreamRef pStream);
+
+    // Map space for rCount vertices, packed in the stream's layout, and
+    // return the index of the first, or -1 if the frame's region is full.
+    // The pointer is valid until VertexArrayStreamUnmap.
+    GLint VertexArrayStreamMap(const GLuint& rCount,
+                               GLvoid **pVertices,
+                               VertexArrayStreamRef pStream);
+
+    // Unmap the vertices written since VertexArrayStreamMap
+    void VertexArrayStreamUnmap(VertexArrayStreamRef pStream);
+
+    // Append vertices, packed in the stream's layout, and return the index
+    // of the first, or -1 if the frame's region is full
+    GLint VertexArrayStreamAppend(const GLuint& rCount,
+                                  const GLvoid * const pVertices,
+                                  VertexArrayStreamRef pStream);
+
+    // Append the vertices of an interleaved array of the same layout,
+    // converted to the attribute types of the stream's vertex layout
+    GLint VertexArrayStreamAppend(const ArrayRef pArray,
+                                  VertexArrayStreamRef pStream);
+
+    // Draw vertices appended this frame
+    void VertexArrayStreamDraw(const GLenum& rMode,
+                               const GLint& rFirst,
+                               const GLsizei& rCount,
+                               const VertexArrayStreamRef pStream);
+
+    // Get VAO id
+    const GLuint VertexArrayStreamGetVAO(const VertexArrayStreamRef pStream);
+} // GLU
+
+#endif
+
+#endif
@@ -0,0 +1,360 @@
+/*
+     File: GLUVertexArrayStream.mm
+ Abstract:
+ Utility toolkit for streaming dynamic geometry through a ring buffer.
+
+ */
+
+#pragma mark -
+#pragma mark Headers
+
+// C string and memory functions
+#import <cstring>
+
+// STL algorithms
+#import <algorithm>
+
+// Mac OS X frameworks
+#import <Cocoa/Cocoa.h>
+
+// OpenGL core profile
+#import <OpenGL/gl3.h>
+
+// OpenGL vertices private type
+#import "GLUVertices.h"
+
+// OpenGL vertex array stream header
+#import "GLUVertexArrayStream.h"
+
+#pragma mark -
+#pragma mark Private - Constants
+
+// Frames that may be in flight, one ring buffer region each
+static const GLuint kStreamRegions = 3;
+
+// Nanoseconds to wait on a fence before polling it again
+static const GLuint64 kStreamTimeout = 1000000;
+
+#pragma mark -
+#pragma mark Private - Data Structures
+
+namespace GLU
+{
+    struct VertexArrayStream
+    {
+        GLuint          mnVAO;
+        GLuint          mnBID;
+        GLuint          mnRegion;                   // Region of the current frame
+        ArrayLayout     mnLayout;                   // Vertex layout
+        GLsizei         mnStride;                   // Bytes per vertex
+        VertexLayoutRef mpLayout;                   // Attribute types of the vertices
+        GLsizeiptr      mnRegionSize;               // Bytes per region, whole vertices
+        GLsizeiptr      mnHead;                     // Next free byte of the current region
+        GLsizeiptr      mnMapped;                   // Bytes mapped, until unmapped
+        GLsync          mpFence[kStreamRegions];    // Draws of each region's last frame
+    }; // VertexArrayStream
+
+    typedef struct VertexArrayStream  VertexArrayStream;
+} // GLU
+
+#pragma mark -
+#pragma mark Private - Utilities - Fences
+
+// Block until the draws that last read a region have completed
+static void GLUVertexArrayStreamWait(const GLuint& rRegion,
+                                     GLU::VertexArrayStreamRef pStream)
+{
+    GLsync pFence = pStream->mpFence[rRegion];
+
+    if(pFence != nullptr)
+    {
+        // Flush once, so the fence is guaranteed to signal, then poll
+        GLenum nStatus = glClientWaitSync(pFence, GL_SYNC_FLUSH_COMMANDS_BIT, kStreamTimeout);
+
+        while(nStatus == GL_TIMEOUT_EXPIRED)
+        {
+            nStatus = glClientWaitSync(pFence, 0, kStreamTimeout);
+        } // while
+
+        if(nStatus == GL_WAIT_FAILED)
+        {
+            NSLog(@">> ERROR: Failed waiting on the fence of vertex array stream region %u!", rRegion);
+        } // if
+
+        glDeleteSync(pFence);
+
+        pStream->mpFence[rRegion] = nullptr;
+    } // if
+} // GLUVertexArrayStreamWait
+
+#pragma mark -
+#pragma mark Public - Constructor
+
+// Create a stream of vertices for a vertex layout, with a ring buffer and
+// a vao
+GLU::VertexArrayStreamRef GLU::VertexArrayStreamCreate(const GLU::VertexLayoutRef pLayout,
+                                                       const GLsizeiptr& rCapacity)
+{
+    GLU::VertexArrayStreamRef pStream = nullptr;
+
+    if((pLayout != nullptr) && (rCapacity > 0))
+    {
+        try
+        {
+            pStream = new GLU::VertexArrayStream;
+
+            pStream->mnLayout = GLU::VertexLayoutGetArrayLayout(pLayout);
+            pStream->mnStride = GLU::VertexLayoutGetStride(pLayout);
+            pStream->mpLayout = GLU::VertexLayoutCreateCopy(pLayout);
+
+            // Regions hold whole vertices, so every append starts at a
+            // vertex index
+            const GLsizeiptr nRegionSize = rCapacity / kStreamRegions / pStream->mnStride * pStream->mnStride;
+
+            pStream->mnRegionSize = std::max(nRegionSize, GLsizeiptr(pStream->mnStride));
+            pStream->mnRegion     = kStreamRegions - 1;
+            pStream->mnHead       = 0;
+            pStream->mnMapped     = 0;
+            pStream->mnVAO        = 0;
+            pStream->mnBID        = 0;
+
+            for(GLuint i = 0; i < kStreamRegions; ++i)
+            {
+                pStream->mpFence[i] = nullptr;
+            } // for
+
+            glGenVertexArrays(1, &pStream->mnVAO);
+            glGenBuffers(1, &pStream->mnBID);
+
+            if(pStream->mnVAO && pStream->mnBID)
+            {
+                glBindVertexArray(pStream->mnVAO);
+                glBindBuffer(GL_ARRAY_BUFFER, pStream->mnBID);
+
+                glBufferData(GL_ARRAY_BUFFER, kStreamRegions * pStream->mnRegionSize, nullptr, GL_STREAM_DRAW);
+
+                GLU::VertexLayoutEnable(0, pLayout);
+
+                glBindVertexArray(0);
+            } // if
+        } // try
+        catch(std::bad_alloc& ba)
+        {
+            NSLog(@">> ERROR: Failed allocating memory for vertex array stream backing store: \"%s\"", ba.what());
+
+            pStream = nullptr;
+        } // catch
+    } // if
+
+    return pStream;
+} // GLUVertexArrayStreamCreate
+
+// Create a stream of vertices in a layout, with a ring buffer and a vao
+GLU::VertexArrayStreamRef GLU::VertexArrayStreamCreate(const GLuint& rProgramID,
+                                                       const GLU::ArrayLayout& rLayout,
+                                                       const GLsizeiptr& rCapacity,
+                                                       const GLchar * const pPosition,
+                                                       const GLchar * const pNormal,
+                                                       const GLchar * const pTexCoord,
+                                                       const GLchar * const pColor)
+{
+    GLU::VertexLayoutRef pLayout = GLU::VertexLayoutCreate(rProgramID,
+                                                           rLayout,
+                                                           pPosition,
+                                                           pNormal,
+                                                           pTexCoord,
+                                                           pColor);
+
+    GLU::VertexArrayStreamRef pStream = GLU::VertexArrayStreamCreate(pLayout, rCapacity);
+
+    GLU::VertexLayoutDelete(pLayout);
+
+    return pStream;
+} // GLUVertexArrayStreamCreate
+
+#pragma mark -
+#pragma mark Public - Destructor
+
+// Delete the stream, its fences, buffer, and vao
+void GLU::VertexArrayStreamDelete(GLU::VertexArrayStreamRef pStream)
+{
+    if(pStream != nullptr)
+    {
+        for(GLuint i = 0; i < kStreamRegions; ++i)
+        {
+            if(pStream->mpFence[i] != nullptr)
+            {
+                glDeleteSync(pStream->mpFence[i]);
+            } // if
+        } // for
+
+        glDeleteBuffers(1, &pStream->mnBID);
+        glDeleteVertexArrays(1, &pStream->mnVAO);
+
+        GLU::VertexLayoutDelete(pStream->mpLayout);
+
+        delete pStream;
+    } // if
+} // GLUVertexArrayStreamDelete
+
+#pragma mark -
+#pragma mark Public - Frames
+
+// Start a frame in the next region of the ring
+void GLU::VertexArrayStreamBegin(GLU::VertexArrayStreamRef pStream)
+{
+    if(pStream != nullptr)
+    {
+        pStream->mnRegion = (pStream->mnRegion + 1) % kStreamRegions;
+        pStream->mnHead   = 0;
+
+        GLUVertexArrayStreamWait(pStream->mnRegion, pStream);
+    } // if
+} // GLUVertexArrayStreamBegin
+
+// Fence the draws of the frame
+void GLU::VertexArrayStreamEnd(GLU::VertexArrayStreamRef pStream)
+{
+    if((pStream != nullptr) && pStream->mnHead)
+    {
+        pStream->mpFence[pStream->mnRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    } // if
+} // GLUVertexArrayStreamEnd
+
+#pragma mark -
+#pragma mark Public - Vertices
+
+// Map space for vertices in the current region
+GLint GLU::VertexArrayStreamMap(const GLuint& rCount,
+                                GLvoid **pVertices,
+                                GLU::VertexArrayStreamRef pStream)
+{
+    GLint nFirst = -1;
+
+    if((pStream != nullptr) && (pVertices != nullptr) && rCount && !pStream->mnMapped)
+    {
+        const GLsizeiptr nSize = GLsizeiptr(rCount) * pStream->mnStride;
+
+        if((pStream->mnHead + nSize) > pStream->mnRegionSize)
+        {
+            NSLog(@">> ERROR: Vertex array stream region is full, %ld of %ld bytes used!",
+                  long(pStream->mnHead), long(pStream->mnRegionSize));
+
+            return nFirst;
+        } // if
+
+        const GLintptr nOffset = pStream->mnRegion * pStream->mnRegionSize + pStream->mnHead;
+
+        glBindBuffer(GL_ARRAY_BUFFER, pStream->mnBID);
+
+        // The region was fenced when its frame began, so nothing in flight
+        // reads it and the write needs no synchronization
+        *pVertices = glMapBufferRange(GL_ARRAY_BUFFER,
+                                      nOffset,
+                                      nSize,
+                                      GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+
+        if(*pVertices != nullptr)
+        {
+            pStream->mnHead  += nSize;
+            pStream->mnMapped = nSize;
+
+            nFirst = GLint(nOffset / pStream->mnStride);
+        } // if
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        } // else
+    } // if
+
+    return nFirst;
+} // GLUVertexArrayStreamMap
+
+// Unmap the vertices written since the last map
+void GLU::VertexArrayStreamUnmap(GLU::VertexArrayStreamRef pStream)
+{
+    if((pStream != nullptr) && pStream->mnMapped)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, pStream->mnBID);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        pStream->mnMapped = 0;
+    } // if
+} // GLUVertexArrayStreamUnmap
+
+// Append packed vertices
+GLint GLU::VertexArrayStreamAppend(const GLuint& rCount,
+                                   const GLvoid * const pVertices,
+                                   GLU::VertexArrayStreamRef pStream)
+{
+    GLvoid *pDst = nullptr;
+
+    GLint nFirst = (pVertices != nullptr) ? GLU::VertexArrayStreamMap(rCount, &pDst, pStream) : -1;
+
+    if(nFirst >= 0)
+    {
+        std::memcpy(pDst, pVertices, GLsizeiptr(rCount) * pStream->mnStride);
+
+        GLU::VertexArrayStreamUnmap(pStream);
+    } // if
+
+    return nFirst;
+} // GLUVertexArrayStreamAppend
+
+// Append the vertices of an interleaved array of the same layout,
+// converted to the stream's attribute types
+GLint GLU::VertexArrayStreamAppend(const GLU::ArrayRef pArray,
+                                   GLU::VertexArrayStreamRef pStream)
+{
+    GLint nFirst = -1;
+
+    if((pArray != nullptr) && (pStream != nullptr))
+    {
+        if(GLU::ArrayGetLayout(pArray) == pStream->mnLayout)
+        {
+            GLvoid *pDst = nullptr;
+
+            nFirst = GLU::VertexArrayStreamMap(pArray->mnSize, &pDst, pStream);
+
+            if(nFirst >= 0)
+            {
+                GLU::VertexLayoutPack(pArray, pArray->mnSize, pDst, pStream->mpLayout);
+
+                GLU::VertexArrayStreamUnmap(pStream);
+            } // if
+        } // if
+        else
+        {
+            NSLog(@">> ERROR: Interleaved array layout does not match the vertex array stream!");
+        } // else
+    } // if
+
+    return nFirst;
+} // GLUVertexArrayStreamAppend
+
+#pragma mark -
+#pragma mark Public - Drawing
+
+// Draw vertices appended this frame
+void GLU::VertexArrayStreamDraw(const GLenum& rMode,
+                                const GLint& rFirst,
+                                const GLsizei& rCount,
+                                const GLU::VertexArrayStreamRef pStream)
+{
+    if((pStream != nullptr) && (rFirst >= 0) && (rCount > 0))
+    {
+        glBindVertexArray(pStream->mnVAO);
+        glDrawArrays(rMode, rFirst, rCount);
+        glBindVertexArray(0);
+    } // if
+} // GLUVertexArrayStreamDraw
+
+#pragma mark -
+#pragma mark Public - Accessors
+
+// Get VAO id
+const GLuint GLU::VertexArrayStreamGetVAO(const GLU::VertexArrayStreamRef pStream)
+{
+    return pStream->mnVAO;
+} // GLUVertexArrayStreamGetVAO
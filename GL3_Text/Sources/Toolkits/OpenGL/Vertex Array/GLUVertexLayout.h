@@ -0,0 +1,99 @@
+/*
+     File: GLUVertexLayout.h
+ Abstract:
+ Utility toolkit for precomputed vertex attribute layouts.
+
+ A layout binds the attributes of an interleaved array layout to the
+ attribute locations of a program.  Locations are queried once, when the
+ layout is created, and attributes are then identified by their
+ ArrayAttribute rather than by name, so vertex arrays built from a layout
+ make no attribute queries and no string lookups.
+
+ A layout may also store attributes in packed types, half-float positions
+ and texture coordinates, normalized bytes for colors, or 10-bit normals.
+ Interleaved arrays stay in floats, and are converted to the layout's
+ packed vertices when they are uploaded.
+
+ */
+
+// MacOS X
+
+#ifndef _GL_UTILITIES_VERTEX_LAYOUT_H_
+#define _GL_UTILITIES_VERTEX_LAYOUT_H_
+
+// OpenGL interleaved array utilities
+#import "GLUArray.h"
+
+#ifdef __cplusplus
+
+namespace GLU
+{
+    // Opaque data reference to an immutable vertex layout, see
+    // GLUVertexArray.h
+    typedef struct VertexLayout *VertexLayoutRef;
+
+    // Storage type of an attribute in vertex buffers
+    enum VertexType
+    {
+        kVertexTypeFloat = 0,   // GL_FLOAT
+        kVertexTypeHalf,        // GL_HALF_FLOAT
+        kVertexTypeUNorm8,      // GL_UNSIGNED_BYTE, normalized, for [0, 1]
+        kVertexTypeInt2101010   // GL_INT_2_10_10_10_REV, normalized, for
+                                // [-1, 1] with 3 or 4 components
+    }; // VertexType
+
+    // Create a layout for a program and an interleaved array layout, with
+    // the program's names for each attribute.  Names may be null for
+    // attributes the program does not use.
+    VertexLayoutRef VertexLayoutCreate(const GLuint& rProgramID,
+                                       const ArrayLayout& rLayout,
+                                       const GLchar * const pPosition,
+                                       const GLchar * const pNormal,
+                                       const GLchar * const pTexCoord,
+                                       const GLchar * const pColor);
+
+    // Create a layout storing attributes in the types of pTypes, indexed by
+    // ArrayAttribute.  Types may be null for all floats.
+    VertexLayoutRef VertexLayoutCreate(const GLuint& rProgramID,
+                                       const ArrayLayout& rLayout,
+                                       const GLchar * const pPosition,
+                                       const GLchar * const pNormal,
+                                       const GLchar * const pTexCoord,
+                                       const GLchar * const pColor,
+                                       const VertexType * const pTypes);
+
+    // Copy a layout
+    VertexLayoutRef VertexLayoutCreateCopy(const VertexLayoutRef pLayout);
+
+    // Delete the layout.  Vertex arrays created from it are unaffected.
+    void VertexLayoutDelete(VertexLayoutRef pLayout);
+
+    // Point the enabled attributes at the array buffer bound to the bound
+    // vao, with vertices starting at a byte offset
+    void VertexLayoutEnable(const GLintptr& rOffset,
+                            const VertexLayoutRef pLayout);
+
+    // Convert rCount vertices of an interleaved array of the same array
+    // layout into the layout's vertices, of VertexLayoutGetStride bytes each
+    bool VertexLayoutPack(const ArrayRef pArray,
+                          const GLuint& rCount,
+                          GLvoid *pVertices,
+                          const VertexLayoutRef pLayout);
+
+    // The program the layout was created for
+    const GLuint VertexLayoutGetProgram(const VertexLayoutRef pLayout);
+
+    // The interleaved array layout
+    const ArrayLayout VertexLayoutGetArrayLayout(const VertexLayoutRef pLayout);
+
+    // Bytes per vertex, in the layout's attribute types
+    const GLsizei VertexLayoutGetStride(const VertexLayoutRef pLayout);
+
+    // Location of an attribute, or -1 if it is not enabled
+    const GLint VertexLayoutGetLocation(const ArrayAttribute& rAttribute,
+                                        const VertexLayoutRef pLayout);
+} // GLU
+
+#endif
+
+#endif
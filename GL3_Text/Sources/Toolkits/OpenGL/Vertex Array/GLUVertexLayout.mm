@@ -0,0 +1,605 @@
+/*
+     File: GLUVertexLayout.mm
+ Abstract:
+ Utility toolkit for precomputed vertex attribute layouts.
+
+ */
+
+#pragma mark -
+#pragma mark Headers
+
+// C math and memory functions
+#import <cmath>
+#import <cstring>
+
+// STL algorithms
+#import <algorithm>
+
+// SIMD conversions of packed attributes
+#if defined(__F16C__)
+#import <immintrin.h>
+#elif defined(__SSE2__)
+#import <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#import <arm_neon.h>
+#endif
+
+// Mac OS X frameworks
+#import <Cocoa/Cocoa.h>
+
+// OpenGL core profile
+#import <OpenGL/gl3.h>
+
+// OpenGL vertices private type
+#import "GLUVertices.h"
+
+// OpenGL vertex layout header
+#import "GLUVertexLayout.h"
+
+#pragma mark -
+#pragma mark Private - Data Structures
+
+namespace GLU
+{
+    // Attribute location and format within a vertex
+    struct VertexFormat
+    {
+        GLint       mnLocation;     // -1 when not enabled
+        GLint       mnSize;         // Components
+        GLsizeiptr  mnOffset;       // Bytes from the start of a vertex
+        GLsizeiptr  mnBytes;        // Bytes of the attribute in a vertex
+        VertexType  mnType;         // Storage type
+        GLenum      mnGLType;       // As passed to glVertexAttribPointer
+        GLboolean   mbNormalized;
+    }; // VertexFormat
+
+    typedef struct VertexFormat  VertexFormat;
+
+    struct VertexLayout
+    {
+        GLuint        mnPID;
+        ArrayLayout   mnLayout;
+        GLsizei       mnStride;
+        bool          mbPacked;     // Any attribute stored in other than floats
+
+        VertexFormat  m_Format[kVertexAttributes];
+    }; // VertexLayout
+
+    typedef struct VertexLayout  VertexLayout;
+} // GLU
+
+#pragma mark -
+#pragma mark Private - Utilities
+
+// Copy a vertex layout's stride, component counts, and offsets
+template <typename Layout>
+static void GLUVertexLayoutSetSize(GLU::VertexLayoutRef pLayout)
+{
+    pLayout->mnStride = sizeof(typename Layout::Vertex);
+
+    for(GLuint i = 0; i < GLU::kVertexAttributes; ++i)
+    {
+        pLayout->m_Format[i].mnLocation = -1;
+        pLayout->m_Format[i].mnSize     = Layout::kCount[i];
+        pLayout->m_Format[i].mnOffset   = Layout::kOffset[i];
+    } // for
+} // GLUVertexLayoutSetSize
+
+// Set the storage type of every attribute.  Packed vertices lay out the
+// attributes one after the other on 4 byte boundaries, float vertices keep
+// the interleaved array's offsets.
+static void GLUVertexLayoutSetFormat(const GLU::VertexType * const pTypes,
+                                     GLU::VertexLayoutRef pLayout)
+{
+    GLsizeiptr nOffset = 0;
+
+    pLayout->mbPacked = false;
+
+    for(GLuint i = 0; i < GLU::kVertexAttributes; ++i)
+    {
+        GLU::VertexFormat& rFormat = pLayout->m_Format[i];
+
+        rFormat.mnType = (pTypes != nullptr) ? pTypes[i] : GLU::kVertexTypeFloat;
+
+        if((rFormat.mnType == GLU::kVertexTypeInt2101010) && (rFormat.mnSize < 3))
+        {
+            NSLog(@">> WARNING: 10-bit attributes need 3 or 4 components, storing floats!");
+
+            rFormat.mnType = GLU::kVertexTypeFloat;
+        } // if
+
+        switch(rFormat.mnType)
+        {
+            case GLU::kVertexTypeHalf:
+                rFormat.mnGLType     = GL_HALF_FLOAT;
+                rFormat.mbNormalized = GL_FALSE;
+                rFormat.mnBytes      = (2 * rFormat.mnSize + 3) & ~3;
+                break;
+
+            case GLU::kVertexTypeUNorm8:
+                rFormat.mnGLType     = GL_UNSIGNED_BYTE;
+                rFormat.mbNormalized = GL_TRUE;
+                rFormat.mnBytes      = 4;
+                break;
+
+            case GLU::kVertexTypeInt2101010:
+                rFormat.mnGLType     = GL_INT_2_10_10_10_REV;
+                rFormat.mbNormalized = GL_TRUE;
+                rFormat.mnBytes      = 4;
+                break;
+
+            default:
+                rFormat.mnType       = GLU::kVertexTypeFloat;
+                rFormat.mnGLType     = GL_FLOAT;
+                rFormat.mbNormalized = GL_FALSE;
+                rFormat.mnBytes      = 4 * rFormat.mnSize;
+                break;
+        } // switch
+
+        if(!rFormat.mnSize)
+        {
+            rFormat.mnBytes = 0;
+        } // if
+
+        pLayout->mbPacked = pLayout->mbPacked || (rFormat.mnBytes && (rFormat.mnType != GLU::kVertexTypeFloat));
+    } // for
+
+    if(pLayout->mbPacked)
+    {
+        for(GLU::VertexFormat& rFormat : pLayout->m_Format)
+        {
+            rFormat.mnOffset = nOffset;
+
+            nOffset += rFormat.mnBytes;
+        } // for
+
+        pLayout->mnStride = GLsizei(nOffset);
+    } // if
+} // GLUVertexLayoutSetFormat
+
+// Resolve an attribute location, once
+static void GLUVertexLayoutSetLocation(const GLU::VertexAttribute& rAttribute,
+                                       const GLchar * const pName,
+                                       GLU::VertexLayoutRef pLayout)
+{
+    GLU::VertexFormat& rFormat = pLayout->m_Format[rAttribute];
+
+    if((pName != nullptr) && rFormat.mnSize)
+    {
+        rFormat.mnLocation = glGetAttribLocation(pLayout->mnPID, pName);
+
+        if(rFormat.mnLocation < 0)
+        {
+            NSLog(@">> WARNING: Program %u has no active attribute \"%s\"!", pLayout->mnPID, pName);
+        } // if
+    } // if
+} // GLUVertexLayoutSetLocation
+
+#pragma mark -
+#pragma mark Private - Utilities - Conversions
+
+// Gather the components of a vertex attribute, padded with zeros
+static inline void GLUVertexLayoutLoad(const GLfloat * const pSrc,
+                                       const GLint& rSize,
+                                       GLfloat *pComponents)
+{
+    pComponents[0] = 0.0f;
+    pComponents[1] = 0.0f;
+    pComponents[2] = 0.0f;
+    pComponents[3] = 0.0f;
+
+    std::memcpy(pComponents, pSrc, rSize * sizeof(GLfloat));
+} // GLUVertexLayoutLoad
+
+#if !defined(__F16C__) && !(defined(__ARM_NEON) && defined(__aarch64__))
+
+// Convert a float to a half-float, rounding to nearest even
+static GLushort GLUVertexLayoutHalf(const GLfloat& rValue)
+{
+    uint32_t nBits = 0;
+
+    std::memcpy(&nBits, &rValue, sizeof(GLfloat));
+
+    const uint32_t nSign     = (nBits >> 16) & 0x8000;
+    const uint32_t nMantissa = nBits & 0x7fffff;
+    const int32_t  nBiased   = int32_t((nBits >> 23) & 0xff);
+    const int32_t  nExponent = nBiased - 127 + 15;
+
+    // Infinity or NaN
+    if(nBiased == 0xff)
+    {
+        return GLushort(nSign | 0x7c00 | (nMantissa ? 0x200 : 0));
+    } // if
+
+    // Overflow to infinity
+    if(nExponent >= 31)
+    {
+        return GLushort(nSign | 0x7c00);
+    } // if
+
+    uint32_t nHalf  = 0;
+    uint32_t nShift = 13;
+    uint32_t nValue = nMantissa;
+
+    if(nExponent <= 0)
+    {
+        // Underflow to zero, or a subnormal half
+        if(nExponent < -10)
+        {
+            return GLushort(nSign);
+        } // if
+
+        nValue = nMantissa | 0x800000;
+        nShift = uint32_t(14 - nExponent);
+    } // if
+    else
+    {
+        nHalf = uint32_t(nExponent) << 10;
+    } // else
+
+    const uint32_t nRest = nValue & ((1u << nShift) - 1);
+    const uint32_t nTie  = 1u << (nShift - 1);
+
+    nHalf |= nValue >> nShift;
+
+    // A carry out of the mantissa rounds up into the exponent
+    if((nRest > nTie) || ((nRest == nTie) && (nHalf & 1)))
+    {
+        ++nHalf;
+    } // if
+
+    return GLushort(nSign | nHalf);
+} // GLUVertexLayoutHalf
+
+#endif
+
+// Convert an attribute to half-floats
+static void GLUVertexLayoutConvertHalf(const GLuint& rCount,
+                                       const GLint& rSize,
+                                       const GLubyte *pSrc,
+                                       const GLsizei& rSrcStride,
+                                       GLubyte *pDst,
+                                       const GLsizei& rDstStride)
+{
+    GLfloat  v[4];
+    GLushort h[4];
+
+    for(GLuint i = 0; i < rCount; ++i, pSrc += rSrcStride, pDst += rDstStride)
+    {
+        GLUVertexLayoutLoad((const GLfloat *)pSrc, rSize, v);
+
+#if defined(__F16C__)
+        _mm_storel_epi64((__m128i *)h, _mm_cvtps_ph(_mm_loadu_ps(v), _MM_FROUND_TO_NEAREST_INT));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        vst1_u16(h, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(v))));
+#else
+        for(GLuint j = 0; j < 4; ++j)
+        {
+            h[j] = GLUVertexLayoutHalf(v[j]);
+        } // for
+#endif
+
+        std::memcpy(pDst, h, (2 * rSize + 3) & ~3);
+    } // for
+} // GLUVertexLayoutConvertHalf
+
+// Convert an attribute in [0, 1] to normalized bytes
+static void GLUVertexLayoutConvertUNorm8(const GLuint& rCount,
+                                         const GLint& rSize,
+                                         const GLubyte *pSrc,
+                                         const GLsizei& rSrcStride,
+                                         GLubyte *pDst,
+                                         const GLsizei& rDstStride)
+{
+    GLfloat v[4];
+    GLubyte b[4];
+
+    for(GLuint i = 0; i < rCount; ++i, pSrc += rSrcStride, pDst += rDstStride)
+    {
+        GLUVertexLayoutLoad((const GLfloat *)pSrc, rSize, v);
+
+#if defined(__SSE2__)
+        __m128  x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(v), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        __m128i n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(255.0f)));
+
+        n = _mm_packs_epi32(n, n);
+        n = _mm_packus_epi16(n, n);
+
+        const int nBytes = _mm_cvtsi128_si32(n);
+
+        std::memcpy(b, &nBytes, 4);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(v), vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+        uint16x4_t  n = vmovn_u32(vcvtnq_u32_f32(vmulq_n_f32(x, 255.0f)));
+
+        vst1_lane_u32((uint32_t *)b, vreinterpret_u32_u8(vmovn_u16(vcombine_u16(n, n))), 0);
+#else
+        for(GLuint j = 0; j < 4; ++j)
+        {
+            b[j] = GLubyte(std::lrint(std::min(std::max(v[j], 0.0f), 1.0f) * 255.0f));
+        } // for
+#endif
+
+        std::memcpy(pDst, b, 4);
+    } // for
+} // GLUVertexLayoutConvertUNorm8
+
+// Convert an attribute in [-1, 1] to signed normalized 10-bit x, y, z and
+// 2-bit w
+static void GLUVertexLayoutConvertInt2101010(const GLuint& rCount,
+                                             const GLint& rSize,
+                                             const GLubyte *pSrc,
+                                             const GLsizei& rSrcStride,
+                                             GLubyte *pDst,
+                                             const GLsizei& rDstStride)
+{
+    GLfloat v[4];
+    GLint   n[4];
+
+    for(GLuint i = 0; i < rCount; ++i, pSrc += rSrcStride, pDst += rDstStride)
+    {
+        GLUVertexLayoutLoad((const GLfloat *)pSrc, rSize, v);
+
+#if defined(__SSE2__)
+        __m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(v), _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+
+        _mm_storeu_si128((__m128i *)n, _mm_cvtps_epi32(_mm_mul_ps(x, _mm_setr_ps(511.0f, 511.0f, 511.0f, 1.0f))));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        static const GLfloat kScale[4] = {511.0f, 511.0f, 511.0f, 1.0f};
+
+        float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(v), vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f));
+
+        vst1q_s32(n, vcvtnq_s32_f32(vmulq_f32(x, vld1q_f32(kScale))));
+#else
+        for(GLuint j = 0; j < 4; ++j)
+        {
+            n[j] = GLint(std::lrint(std::min(std::max(v[j], -1.0f), 1.0f) * ((j < 3) ? 511.0f : 1.0f)));
+        } // for
+#endif
+
+        const uint32_t nPacked = (uint32_t(n[0]) & 0x3ff)
+                               | ((uint32_t(n[1]) & 0x3ff) << 10)
+                               | ((uint32_t(n[2]) & 0x3ff) << 20)
+                               | ((uint32_t(n[3]) & 0x3) << 30);
+
+        std::memcpy(pDst, &nPacked, 4);
+    } // for
+} // GLUVertexLayoutConvertInt2101010
+
+// Convert an attribute of rCount vertices into its storage type
+static void GLUVertexLayoutConvert(const GLuint& rCount,
+                                   const GLU::VertexFormat& rFormat,
+                                   const GLU::ArraySpan& rSpan,
+                                   GLubyte *pDst,
+                                   const GLsizei& rDstStride)
+{
+    const GLubyte *pSrc = (const GLubyte *)rSpan.mpData;
+
+    switch(rFormat.mnType)
+    {
+        case GLU::kVertexTypeHalf:
+            GLUVertexLayoutConvertHalf(rCount, rFormat.mnSize, pSrc, rSpan.mnStride, pDst, rDstStride);
+            break;
+
+        case GLU::kVertexTypeUNorm8:
+            GLUVertexLayoutConvertUNorm8(rCount, rFormat.mnSize, pSrc, rSpan.mnStride, pDst, rDstStride);
+            break;
+
+        case GLU::kVertexTypeInt2101010:
+            GLUVertexLayoutConvertInt2101010(rCount, rFormat.mnSize, pSrc, rSpan.mnStride, pDst, rDstStride);
+            break;
+
+        default:
+            for(GLuint i = 0; i < rCount; ++i, pSrc += rSpan.mnStride, pDst += rDstStride)
+            {
+                std::memcpy(pDst, pSrc, rFormat.mnBytes);
+            } // for
+            break;
+    } // switch
+} // GLUVertexLayoutConvert
+
+#pragma mark -
+#pragma mark Public - Constructor
+
+// Create a layout for a program and an interleaved array layout, storing
+// attributes in the given types
+GLU::VertexLayoutRef GLU::VertexLayoutCreate(const GLuint& rProgramID,
+                                             const GLU::ArrayLayout& rLayout,
+                                             const GLchar * const pPosition,
+                                             const GLchar * const pNormal,
+                                             const GLchar * const pTexCoord,
+                                             const GLchar * const pColor,
+                                             const GLU::VertexType * const pTypes)
+{
+    GLU::VertexLayoutRef pLayout = nullptr;
+
+    if(rProgramID)
+    {
+        try
+        {
+            pLayout = new GLU::VertexLayout;
+
+            pLayout->mnPID    = rProgramID;
+            pLayout->mnLayout = rLayout;
+
+            switch(rLayout)
+            {
+                case GLU::kArrayLayout2D:
+                    GLUVertexLayoutSetSize<GLU::Layout2D>(pLayout);
+                    break;
+
+                case GLU::kArrayLayout3D:
+                    GLUVertexLayoutSetSize<GLU::Layout3D>(pLayout);
+                    break;
+
+                case GLU::kArrayLayout3DNormals:
+                    GLUVertexLayoutSetSize<GLU::Layout3DNormals>(pLayout);
+                    break;
+            } // switch
+
+            GLUVertexLayoutSetFormat(pTypes, pLayout);
+
+            GLUVertexLayoutSetLocation(GLU::kVertexPositions, pPosition, pLayout);
+            GLUVertexLayoutSetLocation(GLU::kVertexNormals,   pNormal,   pLayout);
+            GLUVertexLayoutSetLocation(GLU::kVertexTexCoords, pTexCoord, pLayout);
+            GLUVertexLayoutSetLocation(GLU::kVertexColors,    pColor,    pLayout);
+        } // try
+        catch(std::bad_alloc& ba)
+        {
+            NSLog(@">> ERROR: Failed allocating memory for vertex layout: \"%s\"", ba.what());
+
+            pLayout = nullptr;
+        } // catch
+    } // if
+
+    return pLayout;
+} // GLUVertexLayoutCreate
+
+// Create a layout for a program and an interleaved array layout
+GLU::VertexLayoutRef GLU::VertexLayoutCreate(const GLuint& rProgramID,
+                                             const GLU::ArrayLayout& rLayout,
+                                             const GLchar * const pPosition,
+                                             const GLchar * const pNormal,
+                                             const GLchar * const pTexCoord,
+                                             const GLchar * const pColor)
+{
+    return GLU::VertexLayoutCreate(rProgramID, rLayout, pPosition, pNormal, pTexCoord, pColor, nullptr);
+} // GLUVertexLayoutCreate
+
+// Copy a layout
+GLU::VertexLayoutRef GLU::VertexLayoutCreateCopy(const GLU::VertexLayoutRef pLayout)
+{
+    GLU::VertexLayoutRef pCopy = nullptr;
+
+    if(pLayout != nullptr)
+    {
+        try
+        {
+            pCopy = new GLU::VertexLayout(*pLayout);
+        } // try
+        catch(std::bad_alloc& ba)
+        {
+            NSLog(@">> ERROR: Failed allocating memory for vertex layout copy: \"%s\"", ba.what());
+
+            pCopy = nullptr;
+        } // catch
+    } // if
+
+    return pCopy;
+} // GLUVertexLayoutCreateCopy
+
+#pragma mark -
+#pragma mark Public - Destructor
+
+// Delete the layout
+void GLU::VertexLayoutDelete(GLU::VertexLayoutRef pLayout)
+{
+    if(pLayout != nullptr)
+    {
+        delete pLayout;
+    } // if
+} // GLUVertexLayoutDelete
+
+#pragma mark -
+#pragma mark Public - Attributes
+
+// Point the enabled attributes at the bound array buffer
+void GLU::VertexLayoutEnable(const GLintptr& rOffset,
+                             const GLU::VertexLayoutRef pLayout)
+{
+    if(pLayout != nullptr)
+    {
+        for(const GLU::VertexFormat& rFormat : pLayout->m_Format)
+        {
+            if(rFormat.mnLocation >= 0)
+            {
+                const GLchar *pOffset = (const GLchar *)nullptr + rOffset + rFormat.mnOffset;
+
+                glVertexAttribPointer(rFormat.mnLocation,
+                                      (rFormat.mnGLType == GL_INT_2_10_10_10_REV) ? 4 : rFormat.mnSize,
+                                      rFormat.mnGLType,
+                                      rFormat.mbNormalized,
+                                      pLayout->mnStride,
+                                      pOffset);
+
+                glEnableVertexAttribArray(rFormat.mnLocation);
+            } // if
+        } // for
+    } // if
+} // GLUVertexLayoutEnable
+
+#pragma mark -
+#pragma mark Public - Vertices
+
+// Convert the vertices of an interleaved array into the layout's vertices
+bool GLU::VertexLayoutPack(const GLU::ArrayRef pArray,
+                           const GLuint& rCount,
+                           GLvoid *pVertices,
+                           const GLU::VertexLayoutRef pLayout)
+{
+    if((pArray == nullptr) || (pVertices == nullptr) || (pLayout == nullptr))
+    {
+        return false;
+    } // if
+
+    if(GLU::ArrayGetLayout(pArray) != pLayout->mnLayout)
+    {
+        NSLog(@">> ERROR: Interleaved array layout does not match the vertex layout!");
+
+        return false;
+    } // if
+
+    const GLuint nCount = std::min(rCount, GLU::ArrayGetCount(pArray));
+
+    // Float layouts are the interleaved array's own vertices
+    if(!pLayout->mbPacked)
+    {
+        std::memcpy(pVertices, pArray->mpVertices, GLsizeiptr(nCount) * pLayout->mnStride);
+
+        return true;
+    } // if
+
+    GLubyte *pDst = (GLubyte *)pVertices;
+
+    for(GLuint i = 0; i < GLU::kVertexAttributes; ++i)
+    {
+        const GLU::VertexFormat& rFormat = pLayout->m_Format[i];
+
+        if(rFormat.mnBytes)
+        {
+            const GLU::ArraySpan span = GLU::ArrayGetSpan(GLU::ArrayAttribute(i), pArray);
+
+            GLUVertexLayoutConvert(nCount, rFormat, span, pDst + rFormat.mnOffset, pLayout->mnStride);
+        } // if
+    } // for
+
+    return true;
+} // GLUVertexLayoutPack
+
+#pragma mark -
+#pragma mark Public - Accessors
+
+// The program the layout was created for
+const GLuint GLU::VertexLayoutGetProgram(const GLU::VertexLayoutRef pLayout)
+{
+    return pLayout->mnPID;
+} // GLUVertexLayoutGetProgram
+
+// The interleaved array layout
+const GLU::ArrayLayout GLU::VertexLayoutGetArrayLayout(const GLU::VertexLayoutRef pLayout)
+{
+    return pLayout->mnLayout;
+} // GLUVertexLayoutGetArrayLayout
+
+// Bytes per vertex
+const GLsizei GLU::VertexLayoutGetStride(const GLU::VertexLayoutRef pLayout)
+{
+    return pLayout->mnStride;
+} // GLUVertexLayoutGetStride
+
+// Location of an attribute
+const GLint GLU::VertexLayoutGetLocation(const GLU::ArrayAttribute& rAttribute,
+                                         const GLU::VertexLayoutRef pLayout)
+{
+    return pLayout->m_Format[rAttribute].mnLocation;
+} // GLUVertexLayoutGetLocation
@@ -53,116 +53,156 @@
 #define _GL_UTILITIES_VERTICES_H_
 
 // STL container types
+#import <cstddef>
 #import <vector>
 
-// OpenGL Mac OS X
-#import <OpenGL/OpenGL.h>
-
-// SIMD Math OS X
-#import <simd/simd.h>
+// OpenGL scalar types
+#import "GLMPlatform.h"
 
 #ifdef __cplusplus
 
 namespace GLU
 {
-    // Vertex 2D class
-    struct Vertex2D
+    // Attributes of an interleaved vertex
+    enum VertexAttribute
     {
-        vector_float2 m_Positions;
-        vector_float2 m_Texcoords;
-        vector_float4 m_Colors;
-    }; // GLVertex2D
+        kVertexPositions = 0,
+        kVertexNormals,
+        kVertexTexCoords,
+        kVertexColors,
+        kVertexAttributes
+    }; // VertexAttribute
     
-    typedef struct GLVertex2D GLVertex2D;
+    // Vertex layouts.  Attributes are tightly packed float arrays, so a
+    // vertex is only as large as its attribute set, and that size is the
+    // stride of the vertex buffer.
     
-    // Vertex 3D class with positions, texture coordinates,
-    // and colors
-    struct Vertex3D_1
+    // 2D positions, texture coordinates, and colors, 32 bytes
+    struct Layout2D
     {
-        vector_float3 m_Positions;
-        vector_float3 m_Texcoords;
-        vector_float4 m_Colors;
-    }; // GLVertex3D_1
-    
-    typedef struct GLVertex3D_1 GLVertex3D_1;
-    
-    // Vertex 3D class with positions, normals, texture coordinates,
-    // and colors
-    struct Vertex3D_2
-    {
-        vector_float3 m_Positions;
-        vector_float3 m_Normals;
-        vector_float3 m_Texcoords;
-        vector_float4 m_Colors;
-    }; // GLVertex3D
-    
-    typedef struct GLVertex3D_2 GLVertex3D_2;
+        struct Vertex
+        {
+            Vertex() {}     // Left uninitialized until interleaved
+            
+            GLfloat m_Positions[2];
+            GLfloat m_Texcoords[2];
+            GLfloat m_Colors[4];
+        }; // Vertex
+        
+        static constexpr GLuint kDim = 2;
+        
+        static constexpr GLuint kCount[kVertexAttributes] = {2, 0, 2, 4};
+        
+        static constexpr GLsizeiptr kOffset[kVertexAttributes] =
+        {
+            offsetof(Vertex, m_Positions),
+            0,
+            offsetof(Vertex, m_Texcoords),
+            offsetof(Vertex, m_Colors)
+        };
+    }; // Layout2D
     
-    // Vertex 3D class with positions, texture coordinates, colors,
-    // and with/without normals
-    union Vertex3D
+    // 3D positions, texture coordinates, and colors, 40 bytes
+    struct Layout3D
     {
-        Vertex3D_1  m_v3D_1;
-        Vertex3D_2  m_v3D_2;
-    }; // GLVertex3D
-    
-    typedef union Vertex3D Vertex3D;
+        struct Vertex
+        {
+            Vertex() {}     // Left uninitialized until interleaved
+            
+            GLfloat m_Positions[3];
+            GLfloat m_Texcoords[3];
+            GLfloat m_Colors[4];
+        }; // Vertex
+        
+        static constexpr GLuint kDim = 3;
+        
+        static constexpr GLuint kCount[kVertexAttributes] = {3, 0, 3, 4};
+        
+        static constexpr GLsizeiptr kOffset[kVertexAttributes] =
+        {
+            offsetof(Vertex, m_Positions),
+            0,
+            offsetof(Vertex, m_Texcoords),
+            offsetof(Vertex, m_Colors)
+        };
+    }; // Layout3D
     
-    // 2D or 3D vertex representation
-    class Vertex
+    // 3D positions, normals, texture coordinates, and colors, 52 bytes
+    struct Layout3DNormals
     {
-    public:
-        // 2D vertex constructor
-        Vertex(vector_float2 const & rPositions,
-               vector_float2 const & rTexcoords,
-               vector_float4 const & rColors)
+        struct Vertex
         {
-            m_Vertex2D.m_Positions = rPositions;
-            m_Vertex2D.m_Texcoords = rTexcoords;
-            m_Vertex2D.m_Colors    = rColors;
-        } // constructor
+            Vertex() {}     // Left uninitialized until interleaved
+            
+            GLfloat m_Positions[3];
+            GLfloat m_Normals[3];
+            GLfloat m_Texcoords[3];
+            GLfloat m_Colors[4];
+        }; // Vertex
         
-        // 3D vertex constructor without normals
-        Vertex(vector_float3 const & rPositions,
-               vector_float3 const & rTexcoords,
-               vector_float4 const & rColors)
-        {
-            m_Vertex3D.m_v3D_1.m_Positions = rPositions;
-            m_Vertex3D.m_v3D_1.m_Texcoords = rTexcoords;
-            m_Vertex3D.m_v3D_1.m_Colors    = rColors;
-        } // constructor
+        static constexpr GLuint kDim = 3;
         
-        // 3D vertex constructor with normals
-        Vertex(vector_float3 const & rPositions,
-               vector_float3 const & rNormals,
-               vector_float3 const & rTexcoords,
-               vector_float4 const & rColors)
-        {
-            m_Vertex3D.m_v3D_2.m_Positions = rPositions;
-            m_Vertex3D.m_v3D_2.m_Normals   = rNormals;
-            m_Vertex3D.m_v3D_2.m_Texcoords = rTexcoords;
-            m_Vertex3D.m_v3D_2.m_Colors    = rColors;
-        } // constructor
+        static constexpr GLuint kCount[kVertexAttributes] = {3, 3, 3, 4};
         
-        union
+        static constexpr GLsizeiptr kOffset[kVertexAttributes] =
         {
-            Vertex2D m_Vertex2D;
-            Vertex3D m_Vertex3D;
-        }; // anonymous union
-    }; // Vertex
+            offsetof(Vertex, m_Positions),
+            offsetof(Vertex, m_Normals),
+            offsetof(Vertex, m_Texcoords),
+            offsetof(Vertex, m_Colors)
+        };
+    }; // Layout3DNormals
     
-    // Interleaved array, with either 2D or 3D vertices
+    static_assert(sizeof(Layout2D::Vertex)        == 32, "2D vertices must be packed");
+    static_assert(sizeof(Layout3D::Vertex)        == 40, "3D vertices must be packed");
+    static_assert(sizeof(Layout3DNormals::Vertex) == 52, "3D vertices must be packed");
+    
+    // Interleaved array, described independently of its layout so the
+    // opaque reference and the vertex array setup need not be templates
     struct Array
     {
-        GLuint mnDim;
-        GLuint mnCount[4];
+        virtual ~Array() {}
         
-        std::vector<Vertex>  m_Vertices;
+        GLuint      mnDim;
+        GLuint      mnCount[kVertexAttributes];     // Components per attribute
+        GLsizeiptr  mnOffset[kVertexAttributes];    // Attribute offsets in a vertex
+        GLsizei     mnStride;                       // Bytes per vertex
+        GLuint      mnSize;                         // Vertex count
+        GLubyte    *mpVertices;                     // Owned store, or caller-owned storage
     }; // Array
     
     typedef struct Array Array;
+    
+    // Interleaved array of a given vertex layout
+    template <typename Layout>
+    struct PackedArray : public Array
+    {
+        typedef typename Layout::Vertex  Vertex;
+        
+        PackedArray()
+        {
+            mnDim    = Layout::kDim;
+            mnStride = sizeof(Vertex);
+            mnSize   = 0;
+            
+            mpVertices = nullptr;
+            
+            for(GLuint i = 0; i < kVertexAttributes; ++i)
+            {
+                mnCount[i]  = Layout::kCount[i];
+                mnOffset[i] = Layout::kOffset[i];
+            } // for
+        } // constructor
+        
+        Vertex *GetVertices()
+        {
+            return reinterpret_cast<Vertex *>(mpVertices);
+        } // GetVertices
+        
+        std::vector<Vertex>  m_Vertices;
+    }; // PackedArray
 } // GLU
 
 #endif
 
-#endif
\ No newline at end of file
+#endif
@@ -8,6 +8,8 @@
 
 #include "matrixUtil.h"
 #include "vectorUtil.h"
+#include "simdUtil.h"
+#include "trigUtil.h"
 #include <math.h>
 #include <memory.h>
 
@@ -368,6 +370,72 @@ void mtxLoadScale(float* mtx, float xScale, float yScale, float zScale)
 }
 
 
+void mtxLoadRotateN(float* mtx, const float* deg,
+					const float* xAxis, const float* yAxis, const float* zAxis,
+					unsigned int count)
+{
+	// Angles are converted and run through the batched sincos in chunks
+	enum { CHUNK = 64 };
+	float rad[CHUNK], sin_a[CHUNK], cos_a[CHUNK];
+	unsigned int base, i;
+	
+	for(base = 0; base < count; base += CHUNK)
+	{
+		unsigned int num = (count - base < CHUNK) ? count - base : CHUNK;
+		
+		for(i = 0; i < num; i++)
+		{
+			rad[i] = deg[base + i] * (float)(M_PI/180.0);
+		}
+		
+		trigSinCosN(sin_a, cos_a, rad, num);
+		
+		for(i = 0; i < num; i++)
+		{
+			float* m = mtx + (base + i) * 16;
+			float x = xAxis[base + i];
+			float y = yAxis[base + i];
+			float z = zAxis[base + i];
+			float p = 1.0f / sqrtf(x * x + y * y + z * z);
+			float cos_am = 1.0f - cos_a[i];
+			
+			float xp = x * p;
+			float yp = y * p;
+			float zp = z * p;
+			
+			float xx = xp * xp;
+			float yy = yp * yp;
+			float zz = zp * zp;
+			
+			float xy = xp * yp * cos_am;
+			float yz = yp * zp * cos_am;
+			float zx = zp * xp * cos_am;
+			
+			xp *= sin_a[i];
+			yp *= sin_a[i];
+			zp *= sin_a[i];
+			
+			m[0]  = xx + cos_a[i] * (1.0f - xx);
+			m[1]  = xy + zp;
+			m[2]  = zx - yp;
+			m[3]  = 0.0f;
+			
+			m[4]  = xy - zp;
+			m[5]  = yy + cos_a[i] * (1.0f - yy);
+			m[6]  = yz + xp;
+			m[7]  = 0.0f;
+			
+			m[8]  = zx + yp;
+			m[9]  = yz - xp;
+			m[10] = zz + cos_a[i] * (1.0f - zz);
+			m[11] = 0.0f;
+			
+			m[12] = m[13] = m[14] = 0.0f;
+			m[15] = 1.0f;
+		}
+	}
+}
+
 void mtxLoadRotateX(float* mtx, float rad)
 {
 	// [ 0 4      8 12 ]
@@ -947,3 +1015,139 @@ void mtx3x3Multiply(float* mtx, const float* lhs, const float* rhs)
 	mtx[8] = lhs[2]*rhs[6] + lhs[5] * rhs[7] + lhs[8] * rhs[8];
 }
 
+void mtxExtractFrustumPlanes(float* planes, const float* mvp)
+{
+	// Row i of the column major MVP is (mvp[i], mvp[4+i], mvp[8+i], mvp[12+i])
+	// A clip space point is inside when -w <= x,y,z <= w, so each plane is
+	// row3 +/- row0..2 (Gribb & Hartmann)
+	int i, axis;
+	for(axis = 0; axis < 3; axis++)
+	{
+		float* lo = planes + (axis * 2 + 0) * 4;
+		float* hi = planes + (axis * 2 + 1) * 4;
+		for(i = 0; i < 4; i++)
+		{
+			lo[i] = mvp[i*4 + 3] + mvp[i*4 + axis];
+			hi[i] = mvp[i*4 + 3] - mvp[i*4 + axis];
+		}
+	}
+	
+	for(i = 0; i < MTX_FRUSTUM_PLANE_COUNT; i++)
+	{
+		float* plane = planes + i * 4;
+		float magnitude = sqrtf(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+		if(magnitude > 0.0f)
+		{
+			float invMag = 1.0f / magnitude;
+			plane[0] *= invMag;
+			plane[1] *= invMag;
+			plane[2] *= invMag;
+			plane[3] *= invMag;
+		}
+	}
+}
+
+// Writes BASE + lane for each lane set in MASK without branching on the mask
+static inline unsigned int mtxCompactIndices(unsigned int* visible, unsigned int num,
+											 unsigned int base, int mask)
+{
+	visible[num] = base + 0; num += (mask >> 0) & 1;
+	visible[num] = base + 1; num += (mask >> 1) & 1;
+	visible[num] = base + 2; num += (mask >> 2) & 1;
+	visible[num] = base + 3; num += (mask >> 3) & 1;
+	return num;
+}
+
+// Returns a 4 bit mask of the lanes whose bounding volume (center x, y, z with
+// an effective radius computed per plane) lies at least partly inside PLANES
+static inline int mtxCullBlock(const float* planes,
+							   simd4f x, simd4f y, simd4f z,
+							   simd4f radius, simd4f ex, simd4f ey, simd4f ez, int isBox)
+{
+	simd4f inside = simd4fCmpGE(simd4fSplat(0.0f), simd4fSplat(0.0f));
+	int i;
+	for(i = 0; i < MTX_FRUSTUM_PLANE_COUNT; i++)
+	{
+		const float* plane = planes + i * 4;
+		simd4f a = simd4fSplat(plane[0]);
+		simd4f b = simd4fSplat(plane[1]);
+		simd4f c = simd4fSplat(plane[2]);
+		simd4f dist = simd4fMadd(a, x, simd4fMadd(b, y, simd4fMadd(c, z, simd4fSplat(plane[3]))));
+		simd4f r = radius;
+		
+		if(isBox)
+		{
+			// Projected half extent of the box onto the plane normal
+			r = simd4fMadd(ex, simd4fAbs(a),
+				simd4fMadd(ey, simd4fAbs(b),
+				simd4fMul(ez, simd4fAbs(c))));
+		}
+		
+		inside = simd4fAnd(inside, simd4fCmpGE(simd4fAdd(dist, r), simd4fSplat(0.0f)));
+	}
+	return simd4fMoveMask(inside);
+}
+
+static unsigned int mtxCullVolumes(unsigned int* visible, const float* planes,
+								   const float* x, const float* y, const float* z,
+								   const float* radius,
+								   const float* ex, const float* ey, const float* ez,
+								   unsigned int count)
+{
+	unsigned int num = 0;
+	unsigned int idx = 0;
+	int isBox = (radius == NULL);
+	simd4f zero = simd4fSplat(0.0f);
+	
+	// Two 4-wide halves per iteration
+	for(; idx + 2 * SIMD_WIDTH <= count; idx += 2 * SIMD_WIDTH)
+	{
+		unsigned int half;
+		for(half = idx; half < idx + 2 * SIMD_WIDTH; half += SIMD_WIDTH)
+		{
+			int mask = mtxCullBlock(planes,
+									simd4fLoad(x + half), simd4fLoad(y + half), simd4fLoad(z + half),
+									isBox ? zero : simd4fLoad(radius + half),
+									isBox ? simd4fLoad(ex + half) : zero,
+									isBox ? simd4fLoad(ey + half) : zero,
+									isBox ? simd4fLoad(ez + half) : zero,
+									isBox);
+			num = mtxCompactIndices(visible, num, half, mask);
+		}
+	}
+	
+	// Remaining volumes one at a time
+	for(; idx < count; idx++)
+	{
+		int inside = 1;
+		int i;
+		for(i = 0; i < MTX_FRUSTUM_PLANE_COUNT; i++)
+		{
+			const float* plane = planes + i * 4;
+			float dist = plane[0] * x[idx] + plane[1] * y[idx] + plane[2] * z[idx] + plane[3];
+			float r = isBox ? ex[idx] * fabsf(plane[0]) + ey[idx] * fabsf(plane[1]) + ez[idx] * fabsf(plane[2])
+			                : radius[idx];
+			inside &= (dist + r >= 0.0f);
+		}
+		visible[num] = idx;
+		num += inside;
+	}
+	
+	return num;
+}
+
+unsigned int mtxCullSpheres(unsigned int* visible, const float* planes,
+							const float* x, const float* y, const float* z,
+							const float* radius, unsigned int count)
+{
+	return mtxCullVolumes(visible, planes, x, y, z, radius, NULL, NULL, NULL, count);
+}
+
+unsigned int mtxCullAABBs(unsigned int* visible, const float* planes,
+						  const float* centerX, const float* centerY, const float* centerZ,
+						  const float* extentX, const float* extentY, const float* extentZ,
+						  unsigned int count)
+{
+	return mtxCullVolumes(visible, planes, centerX, centerY, centerZ, NULL,
+						  extentX, extentY, extentZ, count);
+}
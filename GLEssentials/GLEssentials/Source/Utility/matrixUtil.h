@@ -50,6 +50,13 @@ void mtxLoadScale(float* mtx, float xScale, float yScale, float zScale);
 // MTX = RotateXYZMatrix
 void mtxLoadRotate(float*mtx, float deg, float xAxis, float , float zAxis);
 
+// MTX[i] = RotateXYZMatrix(DEG[i], AXIS[i]) for COUNT consecutive matrices.
+// Uses the polynomial sine and cosine from trigUtil.h (absolute error about
+// 1e-7) instead of libm, 4 angles at a time.
+void mtxLoadRotateN(float* mtx, const float* deg,
+					const float* xAxis, const float* yAxis, const float* zAxis,
+					unsigned int count);
+
 // MTX = RotateXMatrix
 void mtxLoadRotateX(float* mtx, float deg);
 
@@ -112,5 +119,31 @@ void mtx3x3Transpose(float* mtx, const float* src);
 // 3x3 MTX = 3x3 SRC^-1
 void mtx3x3Invert(float* mtx, const float* src);
 
+// Frustum planes are stored as 6 consecutive (a, b, c, d) tuples in the order
+// left, right, bottom, top, near, far.  Each plane is normalized so that
+// a*x + b*y + c*z + d is the signed distance of (x, y, z) from the plane,
+// positive on the inside of the frustum.
+#define MTX_FRUSTUM_PLANE_COUNT 6
+
+// PLANES = FrustumPlanes(MVP) - Planes are in the space MVP transforms from
+void mtxExtractFrustumPlanes(float* planes, const float* mvp);
+
+// Culls a batch of bounding spheres against PLANES.  Sphere data is passed as
+// separate x, y, z, radius arrays (structure of arrays) so 8 spheres are
+// tested per iteration.  The indices of the spheres that intersect or lie
+// inside the frustum are written in ascending order to VISIBLE, which must
+// hold COUNT entries.  Returns the number of visible spheres.
+unsigned int mtxCullSpheres(unsigned int* visible, const float* planes,
+							const float* x, const float* y, const float* z,
+							const float* radius, unsigned int count);
+
+// Same as mtxCullSpheres but for axis aligned boxes given as centers and
+// half extents.  Conservative: boxes straddling a frustum corner may be
+// reported visible.
+unsigned int mtxCullAABBs(unsigned int* visible, const float* planes,
+						  const float* centerX, const float* centerY, const float* centerZ,
+						  const float* extentX, const float* extentY, const float* extentZ,
+						  unsigned int count);
+
 #endif //__MATRIX_UTIL_H__
 
@@ -0,0 +1,228 @@
+/*
+ See LICENSE.txt for this sample’s licensing information
+
+ Abstract:
+ Minimal 4-wide float vector abstraction used by the batched math kernels.
+  Maps onto SSE on OS X, NEON on iOS and plain C everywhere else.
+ */
+
+#ifndef __SIMD_UTIL_H__
+#define __SIMD_UTIL_H__
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SIMD_UTIL_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SIMD_UTIL_NEON 1
+#else
+#define SIMD_UTIL_SCALAR 1
+#endif
+
+// Number of floats in a simd4f
+#define SIMD_WIDTH 4
+
+#if SIMD_UTIL_SSE
+
+typedef __m128 simd4f;
+
+static inline simd4f simd4fSplat(float val)                         { return _mm_set1_ps(val); }
+static inline simd4f simd4fLoad(const float* src)                   { return _mm_loadu_ps(src); }
+static inline void   simd4fStore(float* dst, simd4f vec)            { _mm_storeu_ps(dst, vec); }
+static inline simd4f simd4fAdd(simd4f lhs, simd4f rhs)              { return _mm_add_ps(lhs, rhs); }
+static inline simd4f simd4fSub(simd4f lhs, simd4f rhs)              { return _mm_sub_ps(lhs, rhs); }
+static inline simd4f simd4fMul(simd4f lhs, simd4f rhs)              { return _mm_mul_ps(lhs, rhs); }
+static inline simd4f simd4fDiv(simd4f lhs, simd4f rhs)              { return _mm_div_ps(lhs, rhs); }
+static inline simd4f simd4fMadd(simd4f a, simd4f b, simd4f c)       { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+static inline simd4f simd4fMin(simd4f lhs, simd4f rhs)              { return _mm_min_ps(lhs, rhs); }
+static inline simd4f simd4fMax(simd4f lhs, simd4f rhs)              { return _mm_max_ps(lhs, rhs); }
+static inline simd4f simd4fAbs(simd4f vec)                          { return _mm_andnot_ps(_mm_set1_ps(-0.0f), vec); }
+static inline simd4f simd4fSqrt(simd4f vec)                         { return _mm_sqrt_ps(vec); }
+static inline simd4f simd4fRsqrtEstimate(simd4f vec)                { return _mm_rsqrt_ps(vec); }
+static inline simd4f simd4fCmpGE(simd4f lhs, simd4f rhs)            { return _mm_cmpge_ps(lhs, rhs); }
+static inline simd4f simd4fAnd(simd4f lhs, simd4f rhs)              { return _mm_and_ps(lhs, rhs); }
+static inline int    simd4fMoveMask(simd4f mask)                    { return _mm_movemask_ps(mask); }
+static inline simd4f simd4fXor(simd4f lhs, simd4f rhs)              { return _mm_xor_ps(lhs, rhs); }
+static inline simd4f simd4fSelect(simd4f mask, simd4f a, simd4f b)  { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+static inline simd4f simd4fCmpGT(simd4f lhs, simd4f rhs)            { return _mm_cmpgt_ps(lhs, rhs); }
+static inline simd4f simd4fCmpLT(simd4f lhs, simd4f rhs)            { return _mm_cmplt_ps(lhs, rhs); }
+
+typedef __m128i simd4i;
+
+static inline simd4i simd4iSplat(int val)                           { return _mm_set1_epi32(val); }
+static inline simd4i simd4iAdd(simd4i lhs, simd4i rhs)              { return _mm_add_epi32(lhs, rhs); }
+static inline simd4i simd4iAnd(simd4i lhs, simd4i rhs)              { return _mm_and_si128(lhs, rhs); }
+static inline simd4i simd4iShiftLeft(simd4i vec, int bits)          { return _mm_slli_epi32(vec, bits); }
+static inline simd4f simd4iCmpEQ(simd4i lhs, simd4i rhs)            { return _mm_castsi128_ps(_mm_cmpeq_epi32(lhs, rhs)); }
+static inline simd4i simd4fToIntRound(simd4f vec)                   { return _mm_cvtps_epi32(vec); }
+static inline simd4f simd4iToFloat(simd4i vec)                      { return _mm_cvtepi32_ps(vec); }
+static inline simd4f simd4iAsFloat(simd4i vec)                      { return _mm_castsi128_ps(vec); }
+
+#elif SIMD_UTIL_NEON
+
+typedef float32x4_t simd4f;
+
+static inline simd4f simd4fSplat(float val)                         { return vdupq_n_f32(val); }
+static inline simd4f simd4fLoad(const float* src)                   { return vld1q_f32(src); }
+static inline void   simd4fStore(float* dst, simd4f vec)            { vst1q_f32(dst, vec); }
+static inline simd4f simd4fAdd(simd4f lhs, simd4f rhs)              { return vaddq_f32(lhs, rhs); }
+static inline simd4f simd4fSub(simd4f lhs, simd4f rhs)              { return vsubq_f32(lhs, rhs); }
+static inline simd4f simd4fMul(simd4f lhs, simd4f rhs)              { return vmulq_f32(lhs, rhs); }
+static inline simd4f simd4fMadd(simd4f a, simd4f b, simd4f c)       { return vmlaq_f32(c, a, b); }
+static inline simd4f simd4fMin(simd4f lhs, simd4f rhs)              { return vminq_f32(lhs, rhs); }
+static inline simd4f simd4fMax(simd4f lhs, simd4f rhs)              { return vmaxq_f32(lhs, rhs); }
+static inline simd4f simd4fAbs(simd4f vec)                          { return vabsq_f32(vec); }
+static inline simd4f simd4fRsqrtEstimate(simd4f vec)                { return vrsqrteq_f32(vec); }
+static inline simd4f simd4fCmpGE(simd4f lhs, simd4f rhs)            { return vreinterpretq_f32_u32(vcgeq_f32(lhs, rhs)); }
+
+static inline simd4f simd4fAnd(simd4f lhs, simd4f rhs)
+{
+	return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(lhs), vreinterpretq_u32_f32(rhs)));
+}
+
+static inline simd4f simd4fXor(simd4f lhs, simd4f rhs)
+{
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(lhs), vreinterpretq_u32_f32(rhs)));
+}
+
+static inline simd4f simd4fSelect(simd4f mask, simd4f a, simd4f b)
+{
+	return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+}
+
+static inline simd4f simd4fCmpGT(simd4f lhs, simd4f rhs)            { return vreinterpretq_f32_u32(vcgtq_f32(lhs, rhs)); }
+static inline simd4f simd4fCmpLT(simd4f lhs, simd4f rhs)            { return vreinterpretq_f32_u32(vcltq_f32(lhs, rhs)); }
+
+typedef int32x4_t simd4i;
+
+static inline simd4i simd4iSplat(int val)                           { return vdupq_n_s32(val); }
+static inline simd4i simd4iAdd(simd4i lhs, simd4i rhs)              { return vaddq_s32(lhs, rhs); }
+static inline simd4i simd4iAnd(simd4i lhs, simd4i rhs)              { return vandq_s32(lhs, rhs); }
+static inline simd4i simd4iShiftLeft(simd4i vec, int bits)          { return vshlq_s32(vec, vdupq_n_s32(bits)); }
+static inline simd4f simd4iCmpEQ(simd4i lhs, simd4i rhs)            { return vreinterpretq_f32_u32(vceqq_s32(lhs, rhs)); }
+static inline simd4f simd4iToFloat(simd4i vec)                      { return vcvtq_f32_s32(vec); }
+static inline simd4f simd4iAsFloat(simd4i vec)                      { return vreinterpretq_f32_s32(vec); }
+
+static inline simd4i simd4fToIntRound(simd4f vec)
+{
+#if defined(__aarch64__)
+	return vcvtnq_s32_f32(vec);
+#else
+	// Round half away from zero; conversion truncates
+	uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(vec), vdupq_n_u32(0x80000000));
+	float32x4_t half = vreinterpretq_f32_u32(vorrq_u32(sign, vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+	return vcvtq_s32_f32(vaddq_f32(vec, half));
+#endif
+}
+
+static inline simd4f simd4fDiv(simd4f lhs, simd4f rhs)
+{
+#if defined(__aarch64__)
+	return vdivq_f32(lhs, rhs);
+#else
+	// Reciprocal estimate refined by two Newton-Raphson steps
+	float32x4_t inv = vrecpeq_f32(rhs);
+	inv = vmulq_f32(vrecpsq_f32(rhs, inv), inv);
+	inv = vmulq_f32(vrecpsq_f32(rhs, inv), inv);
+	return vmulq_f32(lhs, inv);
+#endif
+}
+
+static inline simd4f simd4fSqrt(simd4f vec)
+{
+#if defined(__aarch64__)
+	return vsqrtq_f32(vec);
+#else
+	float tmp[4];
+	vst1q_f32(tmp, vec);
+	tmp[0] = __builtin_sqrtf(tmp[0]);
+	tmp[1] = __builtin_sqrtf(tmp[1]);
+	tmp[2] = __builtin_sqrtf(tmp[2]);
+	tmp[3] = __builtin_sqrtf(tmp[3]);
+	return vld1q_f32(tmp);
+#endif
+}
+
+static inline int simd4fMoveMask(simd4f mask)
+{
+	// Shift each lane's sign bit down and weight it by its lane position
+	static const uint32_t weights[4] = { 1, 2, 4, 8 };
+	uint32x4_t bits = vmulq_u32(vshrq_n_u32(vreinterpretq_u32_f32(mask), 31), vld1q_u32(weights));
+#if defined(__aarch64__)
+	return (int)vaddvq_u32(bits);
+#else
+	uint32x2_t sum = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+	return (int)(vget_lane_u32(sum, 0) + vget_lane_u32(sum, 1));
+#endif
+}
+
+#else // SIMD_UTIL_SCALAR
+
+typedef struct { float v[4]; } simd4f;
+
+#define SIMD_UTIL_LANES(expr) { simd4f r; int i; for(i = 0; i < 4; i++) { r.v[i] = (expr); } return r; }
+
+static inline simd4f simd4fSplat(float val)                         SIMD_UTIL_LANES(val)
+static inline simd4f simd4fLoad(const float* src)                   SIMD_UTIL_LANES(src[i])
+static inline simd4f simd4fAdd(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES(lhs.v[i] + rhs.v[i])
+static inline simd4f simd4fSub(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES(lhs.v[i] - rhs.v[i])
+static inline simd4f simd4fMul(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES(lhs.v[i] * rhs.v[i])
+static inline simd4f simd4fDiv(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES(lhs.v[i] / rhs.v[i])
+static inline simd4f simd4fMadd(simd4f a, simd4f b, simd4f c)       SIMD_UTIL_LANES(a.v[i] * b.v[i] + c.v[i])
+static inline simd4f simd4fMin(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES(lhs.v[i] < rhs.v[i] ? lhs.v[i] : rhs.v[i])
+static inline simd4f simd4fMax(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES(lhs.v[i] > rhs.v[i] ? lhs.v[i] : rhs.v[i])
+static inline simd4f simd4fAbs(simd4f vec)                          SIMD_UTIL_LANES(vec.v[i] < 0.0f ? -vec.v[i] : vec.v[i])
+static inline simd4f simd4fSqrt(simd4f vec)                         SIMD_UTIL_LANES(__builtin_sqrtf(vec.v[i]))
+static inline simd4f simd4fRsqrtEstimate(simd4f vec)                SIMD_UTIL_LANES(1.0f / __builtin_sqrtf(vec.v[i]))
+
+// Comparison results are 0.0f or -0.0f so the sign bit carries the lane mask
+static inline simd4f simd4fCmpGE(simd4f lhs, simd4f rhs)            SIMD_UTIL_LANES(lhs.v[i] >= rhs.v[i] ? -0.0f : 0.0f)
+static inline simd4f simd4fAnd(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES((__builtin_signbit(lhs.v[i]) && __builtin_signbit(rhs.v[i])) ? -0.0f : 0.0f)
+
+static inline simd4f simd4fCmpGT(simd4f lhs, simd4f rhs)            SIMD_UTIL_LANES(lhs.v[i] > rhs.v[i] ? -0.0f : 0.0f)
+static inline simd4f simd4fCmpLT(simd4f lhs, simd4f rhs)            SIMD_UTIL_LANES(lhs.v[i] < rhs.v[i] ? -0.0f : 0.0f)
+static inline simd4f simd4fSelect(simd4f mask, simd4f a, simd4f b)  SIMD_UTIL_LANES(__builtin_signbit(mask.v[i]) ? a.v[i] : b.v[i])
+
+// Only the sign bit of RHS is used, which is all the callers flip
+static inline simd4f simd4fXor(simd4f lhs, simd4f rhs)              SIMD_UTIL_LANES(__builtin_signbit(rhs.v[i]) ? -lhs.v[i] : lhs.v[i])
+
+#undef SIMD_UTIL_LANES
+
+typedef struct { int v[4]; } simd4i;
+
+#define SIMD_UTIL_LANES_I(expr) { simd4i r; int i; for(i = 0; i < 4; i++) { r.v[i] = (expr); } return r; }
+#define SIMD_UTIL_LANES_F(expr) { simd4f r; int i; for(i = 0; i < 4; i++) { r.v[i] = (expr); } return r; }
+
+static inline simd4i simd4iSplat(int val)                           SIMD_UTIL_LANES_I(val)
+static inline simd4i simd4iAdd(simd4i lhs, simd4i rhs)              SIMD_UTIL_LANES_I(lhs.v[i] + rhs.v[i])
+static inline simd4i simd4iAnd(simd4i lhs, simd4i rhs)              SIMD_UTIL_LANES_I(lhs.v[i] & rhs.v[i])
+static inline simd4i simd4iShiftLeft(simd4i vec, int bits)          SIMD_UTIL_LANES_I((int)((unsigned int)vec.v[i] << bits))
+static inline simd4i simd4fToIntRound(simd4f vec)                   SIMD_UTIL_LANES_I((int)__builtin_lrintf(vec.v[i]))
+static inline simd4f simd4iCmpEQ(simd4i lhs, simd4i rhs)            SIMD_UTIL_LANES_F(lhs.v[i] == rhs.v[i] ? -0.0f : 0.0f)
+static inline simd4f simd4iToFloat(simd4i vec)                      SIMD_UTIL_LANES_F((float)vec.v[i])
+
+// Only ever used to build sign masks, so bit 31 is all that matters
+static inline simd4f simd4iAsFloat(simd4i vec)                      SIMD_UTIL_LANES_F((vec.v[i] < 0) ? -0.0f : 0.0f)
+
+#undef SIMD_UTIL_LANES_I
+#undef SIMD_UTIL_LANES_F
+
+static inline void simd4fStore(float* dst, simd4f vec)
+{
+	dst[0] = vec.v[0];
+	dst[1] = vec.v[1];
+	dst[2] = vec.v[2];
+	dst[3] = vec.v[3];
+}
+
+static inline int simd4fMoveMask(simd4f mask)
+{
+	return (__builtin_signbit(mask.v[0]) ? 1 : 0) |
+	       (__builtin_signbit(mask.v[1]) ? 2 : 0) |
+	       (__builtin_signbit(mask.v[2]) ? 4 : 0) |
+	       (__builtin_signbit(mask.v[3]) ? 8 : 0);
+}
+
+#endif
+
+#endif //__SIMD_UTIL_H__
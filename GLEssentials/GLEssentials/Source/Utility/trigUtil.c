@@ -0,0 +1,223 @@
+/*
+ See LICENSE.txt for this sample’s licensing information
+ 
+ Abstract:
+ Polynomial approximations of sine, cosine, tangent and arc tangent that run
+  4 values at a time.
+ */
+
+#include "trigUtil.h"
+#include "simdUtil.h"
+
+#include <stddef.h>
+
+// pi/2 split in three parts (Cody & Waite) so that angle - k * pi/2 stays
+// exact for the k in range
+#define TRIG_PIO2_1 1.5703125f
+#define TRIG_PIO2_2 4.837512969970703125e-4f
+#define TRIG_PIO2_3 7.54978995489188216e-8f
+#define TRIG_2OPI   0.636619772367581343f
+
+// Minimax coefficients on [-pi/4, pi/4] (Cephes sinf/cosf)
+#define TRIG_SIN_1 -1.6666654611e-1f
+#define TRIG_SIN_2  8.3321608736e-3f
+#define TRIG_SIN_3 -1.9515295891e-4f
+
+#define TRIG_COS_1  4.166664568298827e-2f
+#define TRIG_COS_2 -1.388731625493765e-3f
+#define TRIG_COS_3  2.443315711809948e-5f
+
+// atan on [-tan(pi/8), tan(pi/8)] (Cephes atanf)
+#define TRIG_ATAN_1  8.05374449538e-2f
+#define TRIG_ATAN_2 -1.38776856032e-1f
+#define TRIG_ATAN_3  1.99777106478e-1f
+#define TRIG_ATAN_4 -3.33329491539e-1f
+
+#define TRIG_TAN_PI_8 0.414213562373095f
+#define TRIG_PI       3.14159265358979f
+#define TRIG_PI_2     1.57079632679490f
+#define TRIG_PI_4     0.785398163397448f
+
+// Reduces ANGLE to R in [-pi/4, pi/4] with ANGLE = R + QUADRANT * pi/2 and
+// evaluates the sine and cosine polynomials of R
+static inline void trigReduce(simd4f angle, simd4i* quadrant, simd4f* sinR, simd4f* cosR)
+{
+	simd4i q = simd4fToIntRound(simd4fMul(angle, simd4fSplat(TRIG_2OPI)));
+	simd4f k = simd4iToFloat(q);
+	simd4f r, r2;
+	
+	r = simd4fSub(angle, simd4fMul(k, simd4fSplat(TRIG_PIO2_1)));
+	r = simd4fSub(r,     simd4fMul(k, simd4fSplat(TRIG_PIO2_2)));
+	r = simd4fSub(r,     simd4fMul(k, simd4fSplat(TRIG_PIO2_3)));
+	r2 = simd4fMul(r, r);
+	
+	// sin(r) = r + r^3 * (S1 + r^2 * (S2 + r^2 * S3))
+	*sinR = simd4fMadd(simd4fSplat(TRIG_SIN_3), r2, simd4fSplat(TRIG_SIN_2));
+	*sinR = simd4fMadd(*sinR, r2, simd4fSplat(TRIG_SIN_1));
+	*sinR = simd4fMadd(simd4fMul(*sinR, r2), r, r);
+	
+	// cos(r) = 1 - r^2 / 2 + r^4 * (C1 + r^2 * (C2 + r^2 * C3))
+	*cosR = simd4fMadd(simd4fSplat(TRIG_COS_3), r2, simd4fSplat(TRIG_COS_2));
+	*cosR = simd4fMadd(*cosR, r2, simd4fSplat(TRIG_COS_1));
+	*cosR = simd4fMadd(simd4fMul(*cosR, r2), r2, simd4fMadd(r2, simd4fSplat(-0.5f), simd4fSplat(1.0f)));
+	
+	*quadrant = q;
+}
+
+static inline void trigSinCosBlock(simd4f angle, simd4f* s, simd4f* c)
+{
+	simd4i q;
+	simd4f sinR, cosR, swap, signS, signC;
+	
+	trigReduce(angle, &q, &sinR, &cosR);
+	
+	// Odd quadrants swap sine and cosine
+	swap = simd4iCmpEQ(simd4iAnd(q, simd4iSplat(1)), simd4iSplat(1));
+	
+	// Sine is negated in quadrants 2 and 3, cosine in quadrants 1 and 2.
+	// Bit 1 of the quadrant moves to the sign bit.
+	signS = simd4iAsFloat(simd4iShiftLeft(simd4iAnd(q, simd4iSplat(2)), 30));
+	signC = simd4iAsFloat(simd4iShiftLeft(simd4iAnd(simd4iAdd(q, simd4iSplat(1)), simd4iSplat(2)), 30));
+	
+	*s = simd4fXor(simd4fSelect(swap, cosR, sinR), signS);
+	*c = simd4fXor(simd4fSelect(swap, sinR, cosR), signC);
+}
+
+static inline simd4f trigTanBlock(simd4f angle)
+{
+	simd4i q;
+	simd4f sinR, cosR, odd;
+	
+	trigReduce(angle, &q, &sinR, &cosR);
+	
+	// tan(r + k * pi/2) is tan(r) for even k and -1/tan(r) for odd k
+	odd = simd4iCmpEQ(simd4iAnd(q, simd4iSplat(1)), simd4iSplat(1));
+	
+	return simd4fDiv(simd4fSelect(odd, simd4fXor(cosR, simd4fSplat(-0.0f)), sinR),
+					 simd4fSelect(odd, sinR, cosR));
+}
+
+static inline simd4f trigAtan2Block(simd4f y, simd4f x)
+{
+	simd4f zero = simd4fSplat(0.0f);
+	simd4f ax = simd4fAbs(x);
+	simd4f ay = simd4fAbs(y);
+	simd4f hi = simd4fMax(ax, ay);
+	simd4f lo = simd4fMin(ax, ay);
+	simd4f t, big, offset, z, p, res;
+	
+	// t = atan argument in [0, 1]; hi is clamped so atan2(0, 0) = 0
+	t = simd4fDiv(lo, simd4fMax(hi, simd4fSplat(1.0e-30f)));
+	
+	// atan(t) = pi/4 + atan((t - 1) / (t + 1)) above tan(pi/8)
+	big = simd4fCmpGT(t, simd4fSplat(TRIG_TAN_PI_8));
+	t = simd4fSelect(big, simd4fDiv(simd4fSub(t, simd4fSplat(1.0f)), simd4fAdd(t, simd4fSplat(1.0f))), t);
+	offset = simd4fSelect(big, simd4fSplat(TRIG_PI_4), zero);
+	
+	z = simd4fMul(t, t);
+	p = simd4fMadd(simd4fSplat(TRIG_ATAN_1), z, simd4fSplat(TRIG_ATAN_2));
+	p = simd4fMadd(p, z, simd4fSplat(TRIG_ATAN_3));
+	p = simd4fMadd(p, z, simd4fSplat(TRIG_ATAN_4));
+	res = simd4fAdd(offset, simd4fMadd(simd4fMul(p, z), t, t));
+	
+	// Undo the octant folding
+	res = simd4fSelect(simd4fCmpGT(ay, ax), simd4fSub(simd4fSplat(TRIG_PI_2), res), res);
+	res = simd4fSelect(simd4fCmpLT(x, zero), simd4fSub(simd4fSplat(TRIG_PI), res), res);
+	res = simd4fSelect(simd4fCmpLT(y, zero), simd4fXor(res, simd4fSplat(-0.0f)), res);
+	
+	return res;
+}
+
+// Loads up to 4 values, padding with zeros
+static inline simd4f trigLoadTail(const float* src, unsigned int count)
+{
+	float tmp[SIMD_WIDTH] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	unsigned int i;
+	for(i = 0; i < count; i++)
+	{
+		tmp[i] = src[i];
+	}
+	return simd4fLoad(tmp);
+}
+
+// Stores the first COUNT values
+static inline void trigStoreTail(float* dst, simd4f vec, unsigned int count)
+{
+	float tmp[SIMD_WIDTH];
+	unsigned int i;
+	simd4fStore(tmp, vec);
+	for(i = 0; i < count; i++)
+	{
+		dst[i] = tmp[i];
+	}
+}
+
+void trigSinCosN(float* s, float* c, const float* angle, unsigned int count)
+{
+	unsigned int idx = 0;
+	simd4f vs, vc;
+	
+	for(; idx + SIMD_WIDTH <= count; idx += SIMD_WIDTH)
+	{
+		trigSinCosBlock(simd4fLoad(angle + idx), &vs, &vc);
+		if(s) simd4fStore(s + idx, vs);
+		if(c) simd4fStore(c + idx, vc);
+	}
+	
+	if(idx < count)
+	{
+		trigSinCosBlock(trigLoadTail(angle + idx, count - idx), &vs, &vc);
+		if(s) trigStoreTail(s + idx, vs, count - idx);
+		if(c) trigStoreTail(c + idx, vc, count - idx);
+	}
+}
+
+void trigTanN(float* t, const float* angle, unsigned int count)
+{
+	unsigned int idx = 0;
+	
+	for(; idx + SIMD_WIDTH <= count; idx += SIMD_WIDTH)
+	{
+		simd4fStore(t + idx, trigTanBlock(simd4fLoad(angle + idx)));
+	}
+	
+	if(idx < count)
+	{
+		trigStoreTail(t + idx, trigTanBlock(trigLoadTail(angle + idx, count - idx)), count - idx);
+	}
+}
+
+void trigAtan2N(float* a, const float* y, const float* x, unsigned int count)
+{
+	unsigned int idx = 0;
+	
+	for(; idx + SIMD_WIDTH <= count; idx += SIMD_WIDTH)
+	{
+		simd4fStore(a + idx, trigAtan2Block(simd4fLoad(y + idx), simd4fLoad(x + idx)));
+	}
+	
+	if(idx < count)
+	{
+		unsigned int rem = count - idx;
+		trigStoreTail(a + idx, trigAtan2Block(trigLoadTail(y + idx, rem), trigLoadTail(x + idx, rem)), rem);
+	}
+}
+
+void trigSinCos(float angle, float* s, float* c)
+{
+	trigSinCosN(s, c, &angle, 1);
+}
+
+float trigTan(float angle)
+{
+	float t;
+	trigTanN(&t, &angle, 1);
+	return t;
+}
+
+float trigAtan2(float y, float x)
+{
+	float a;
+	trigAtan2N(&a, &y, &x, 1);
+	return a;
+}
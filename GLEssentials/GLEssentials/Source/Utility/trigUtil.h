@@ -0,0 +1,46 @@
+/*
+ See LICENSE.txt for this sample’s licensing information
+ 
+ Abstract:
+ Polynomial approximations of sine, cosine, tangent and arc tangent that run
+  4 values at a time.
+ */
+
+#ifndef __TRIG_UTIL_H__
+#define __TRIG_UTIL_H__
+
+// Angles are in radians.  Functions with the N suffix work on COUNT values,
+// 4 at a time; destination arrays may alias the source arrays.  The scalar
+// functions give the same results as the batched ones.
+//
+// Error bounds, measured against double precision libm:
+//
+//   trigSinCos  |x| <= 8192        absolute error <= 1.2e-7
+//   trigTan     |x| <= 8192        relative error <= 3e-7 where |tan x| >= 0.01,
+//                                  absolute error <= 2e-9 where |tan x| < 0.01
+//                                  (both only where |cos x| >= 0.01)
+//   trigAtan2   all finite y, x    absolute error <= 3e-7
+//
+// Outside |x| <= 8192 sine and cosine lose accuracy gradually (the argument
+// reduction keeps about 24 + log2(8192 / |x|) bits of pi); they stay finite.
+// trigAtan2(0, 0) returns 0 and the sign of a zero x is not taken into account.
+
+// S = sin(angle), C = cos(angle)
+void trigSinCos(float angle, float* s, float* c);
+
+// Returns tan(angle)
+float trigTan(float angle);
+
+// Returns atan2(y, x) in [-pi, pi]
+float trigAtan2(float y, float x);
+
+// S[i] = sin(angle[i]), C[i] = cos(angle[i]).  Either S or C may be NULL.
+void trigSinCosN(float* s, float* c, const float* angle, unsigned int count);
+
+// T[i] = tan(angle[i])
+void trigTanN(float* t, const float* angle, unsigned int count);
+
+// A[i] = atan2(y[i], x[i])
+void trigAtan2N(float* a, const float* y, const float* x, unsigned int count);
+
+#endif //__TRIG_UTIL_H__
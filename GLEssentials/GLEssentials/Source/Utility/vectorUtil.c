@@ -7,7 +7,9 @@
  */
 
 #include "vectorUtil.h"
+#include "simdUtil.h"
 
+#include <float.h>
 #include <math.h>
 #include <memory.h>
 
@@ -114,3 +116,217 @@ void vec3Normalize(float* vec, const float* src)
 }
 
 
+// Returns non zero when the estimate can be used for every lane of LENSQ:
+// the hardware treats denormals as zero and infinities give a zero estimate,
+// so anything outside the normal range goes through sqrt instead
+static inline int vecRsqrtInRange(simd4f lenSq, vecPrecision precision)
+{
+	simd4f mask;
+	
+	if(precision == VEC_PRECISION_EXACT)
+	{
+		return 0;
+	}
+	
+	mask = simd4fAnd(simd4fCmpGE(lenSq, simd4fSplat(FLT_MIN)),
+					 simd4fCmpGE(simd4fSplat(FLT_MAX), lenSq));
+	
+	return simd4fMoveMask(mask) == 0xF;
+}
+
+// Returns an estimate of 1 / sqrt(lenSq) at the requested precision
+static inline simd4f vecRsqrt(simd4f lenSq, vecPrecision precision)
+{
+	simd4f est = simd4fRsqrtEstimate(lenSq);
+	
+	if(precision == VEC_PRECISION_REFINED)
+	{
+		// est = est * (1.5 - 0.5 * lenSq * est * est)
+		simd4f halfLenSq = simd4fMul(lenSq, simd4fSplat(0.5f));
+		simd4f estSq = simd4fMul(est, est);
+		est = simd4fMul(est, simd4fSub(simd4fSplat(1.5f), simd4fMul(halfLenSq, estSq)));
+	}
+	
+	return est;
+}
+
+// Copies the last COUNT (< 4) elements of up to 6 arrays into zero padded
+// 4 element blocks so the tail can be run through the vector code path
+static inline void vecLoadTail(float (*tmp)[SIMD_WIDTH], const float** src, int arrays,
+							   unsigned int offset, unsigned int count)
+{
+	int i;
+	unsigned int j;
+	for(i = 0; i < arrays; i++)
+	{
+		tmp[i][0] = tmp[i][1] = tmp[i][2] = tmp[i][3] = 0.0f;
+		for(j = 0; j < count; j++)
+		{
+			tmp[i][j] = src[i][offset + j];
+		}
+	}
+}
+
+static inline void vec3NormalizeBlock(float* x, float* y, float* z,
+									  const float* srcX, const float* srcY, const float* srcZ,
+									  vecPrecision precision)
+{
+	simd4f vx = simd4fLoad(srcX);
+	simd4f vy = simd4fLoad(srcY);
+	simd4f vz = simd4fLoad(srcZ);
+	simd4f lenSq = simd4fMadd(vx, vx, simd4fMadd(vy, vy, simd4fMul(vz, vz)));
+	
+	if(vecRsqrtInRange(lenSq, precision))
+	{
+		simd4f scale = vecRsqrt(lenSq, precision);
+		
+		simd4fStore(x, simd4fMul(vx, scale));
+		simd4fStore(y, simd4fMul(vy, scale));
+		simd4fStore(z, simd4fMul(vz, scale));
+	}
+	else
+	{
+		// Divide like vec3Normalize, then zero the lanes that had no length
+		simd4f len = simd4fSqrt(lenSq);
+		simd4f nonZero = simd4fCmpGT(lenSq, simd4fSplat(0.0f));
+		simd4f zero = simd4fSplat(0.0f);
+		
+		simd4fStore(x, simd4fSelect(nonZero, simd4fDiv(vx, len), zero));
+		simd4fStore(y, simd4fSelect(nonZero, simd4fDiv(vy, len), zero));
+		simd4fStore(z, simd4fSelect(nonZero, simd4fDiv(vz, len), zero));
+	}
+}
+
+void vec3NormalizeN(float* x, float* y, float* z,
+					const float* srcX, const float* srcY, const float* srcZ,
+					unsigned int count, vecPrecision precision)
+{
+	unsigned int idx = 0;
+	unsigned int rem;
+	
+	for(; idx + SIMD_WIDTH <= count; idx += SIMD_WIDTH)
+	{
+		vec3NormalizeBlock(x + idx, y + idx, z + idx,
+						   srcX + idx, srcY + idx, srcZ + idx, precision);
+	}
+	
+	rem = count - idx;
+	if(rem)
+	{
+		float tmp[3][SIMD_WIDTH];
+		const float* src[3] = { srcX, srcY, srcZ };
+		unsigned int j;
+		
+		vecLoadTail(tmp, src, 3, idx, rem);
+		vec3NormalizeBlock(tmp[0], tmp[1], tmp[2], tmp[0], tmp[1], tmp[2], precision);
+		
+		for(j = 0; j < rem; j++)
+		{
+			x[idx + j] = tmp[0][j];
+			y[idx + j] = tmp[1][j];
+			z[idx + j] = tmp[2][j];
+		}
+	}
+}
+
+static inline void vec3LengthBlock(float* len, const float* x, const float* y, const float* z,
+								   vecPrecision precision)
+{
+	simd4f vx = simd4fLoad(x);
+	simd4f vy = simd4fLoad(y);
+	simd4f vz = simd4fLoad(z);
+	simd4f lenSq = simd4fMadd(vx, vx, simd4fMadd(vy, vy, simd4fMul(vz, vz)));
+	
+	if(vecRsqrtInRange(lenSq, precision))
+	{
+		// sqrt(x) = x * 1/sqrt(x)
+		simd4fStore(len, simd4fMul(lenSq, vecRsqrt(lenSq, precision)));
+	}
+	else
+	{
+		simd4fStore(len, simd4fSqrt(lenSq));
+	}
+}
+
+void vec3LengthN(float* len,
+				 const float* x, const float* y, const float* z,
+				 unsigned int count, vecPrecision precision)
+{
+	unsigned int idx = 0;
+	unsigned int rem;
+	
+	for(; idx + SIMD_WIDTH <= count; idx += SIMD_WIDTH)
+	{
+		vec3LengthBlock(len + idx, x + idx, y + idx, z + idx, precision);
+	}
+	
+	rem = count - idx;
+	if(rem)
+	{
+		float tmp[4][SIMD_WIDTH];
+		const float* src[3] = { x, y, z };
+		unsigned int j;
+		
+		vecLoadTail(tmp, src, 3, idx, rem);
+		vec3LengthBlock(tmp[3], tmp[0], tmp[1], tmp[2], precision);
+		
+		for(j = 0; j < rem; j++)
+		{
+			len[idx + j] = tmp[3][j];
+		}
+	}
+}
+
+void vec3DotProductN(float* dot,
+					 const float* lhsX, const float* lhsY, const float* lhsZ,
+					 const float* rhsX, const float* rhsY, const float* rhsZ,
+					 unsigned int count)
+{
+	unsigned int idx = 0;
+	
+	for(; idx + SIMD_WIDTH <= count; idx += SIMD_WIDTH)
+	{
+		simd4f res = simd4fMul(simd4fLoad(lhsZ + idx), simd4fLoad(rhsZ + idx));
+		res = simd4fMadd(simd4fLoad(lhsY + idx), simd4fLoad(rhsY + idx), res);
+		res = simd4fMadd(simd4fLoad(lhsX + idx), simd4fLoad(rhsX + idx), res);
+		simd4fStore(dot + idx, res);
+	}
+	
+	for(; idx < count; idx++)
+	{
+		dot[idx] = lhsX[idx]*rhsX[idx] + lhsY[idx]*rhsY[idx] + lhsZ[idx]*rhsZ[idx];
+	}
+}
+
+void vec3CrossProductN(float* x, float* y, float* z,
+					   const float* lhsX, const float* lhsY, const float* lhsZ,
+					   const float* rhsX, const float* rhsY, const float* rhsZ,
+					   unsigned int count)
+{
+	unsigned int idx = 0;
+	
+	for(; idx + SIMD_WIDTH <= count; idx += SIMD_WIDTH)
+	{
+		simd4f lx = simd4fLoad(lhsX + idx);
+		simd4f ly = simd4fLoad(lhsY + idx);
+		simd4f lz = simd4fLoad(lhsZ + idx);
+		simd4f rx = simd4fLoad(rhsX + idx);
+		simd4f ry = simd4fLoad(rhsY + idx);
+		simd4f rz = simd4fLoad(rhsZ + idx);
+		
+		// All inputs are loaded before storing so the outputs may alias them
+		simd4fStore(x + idx, simd4fSub(simd4fMul(ly, rz), simd4fMul(lz, ry)));
+		simd4fStore(y + idx, simd4fSub(simd4fMul(lz, rx), simd4fMul(lx, rz)));
+		simd4fStore(z + idx, simd4fSub(simd4fMul(lx, ry), simd4fMul(ly, rx)));
+	}
+	
+	for(; idx < count; idx++)
+	{
+		float lx = lhsX[idx], ly = lhsY[idx], lz = lhsZ[idx];
+		float rx = rhsX[idx], ry = rhsY[idx], rz = rhsZ[idx];
+		
+		x[idx] = ly * rz - lz * ry;
+		y[idx] = lz * rx - lx * rz;
+		z[idx] = lx * ry - ly * rx;
+	}
+}
@@ -56,4 +56,49 @@ float vec3Length(const float* vec);
 // Returns the distance between two 3D points
 float vec3Distance(const float* pointA, const float* pointB);
 
+
+// Batched functions with the N suffix work on COUNT vectors stored as
+// separate x, y and z arrays (structure of arrays) and process 4 vectors at a
+// time.  Destination arrays may alias the source arrays.
+
+// Precision of the batched functions that take a reciprocal square root
+typedef enum
+{
+	// Hardware estimate only: about 12 bits on SSE, 8 bits on NEON
+	VEC_PRECISION_FAST,
+	
+	// Estimate refined by one Newton-Raphson step: about 22 bits, relative
+	// error below 2e-6 on SSE
+	VEC_PRECISION_REFINED,
+	
+	// sqrt and divide, same results as vec3Normalize and vec3Length
+	VEC_PRECISION_EXACT
+} vecPrecision;
+
+// The estimate only covers normal squared lengths: a block of 4 vectors
+// holding one whose squared length underflows or overflows a float is run
+// at VEC_PRECISION_EXACT whatever the requested precision.
+
+// Normalizes COUNT 3D vectors.  Zero length vectors stay zero, where
+// vec3Normalize would return NaNs.
+void vec3NormalizeN(float* x, float* y, float* z,
+					const float* srcX, const float* srcY, const float* srcZ,
+					unsigned int count, vecPrecision precision);
+
+// Returns the length of COUNT 3D vectors in LEN
+void vec3LengthN(float* len,
+				 const float* x, const float* y, const float* z,
+				 unsigned int count, vecPrecision precision);
+
+// Returns the Dot Product of COUNT pairs of 3D vectors in DOT
+void vec3DotProductN(float* dot,
+					 const float* lhsX, const float* lhsY, const float* lhsZ,
+					 const float* rhsX, const float* rhsY, const float* rhsZ,
+					 unsigned int count);
+
+// Calculates the Cross Product of COUNT pairs of 3D vectors
+void vec3CrossProductN(float* x, float* y, float* z,
+					   const float* lhsX, const float* lhsY, const float* lhsZ,
+					   const float* rhsX, const float* rhsY, const float* rhsZ,
+					   unsigned int count);
 #endif //__VECTOR_UTIL_H__
@@ -54,6 +54,7 @@
 {
     Texture *texture;
     GLuint textureName;
+    GLuint sphereLists[2];
     float animationPhase;
     float cameraDistance;
     float rollAngle;
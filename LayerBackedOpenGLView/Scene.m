@@ -53,12 +53,19 @@ static double dtor( double degrees ) {
     return degrees * M_PI / 180.0;
 }
 
+// Size and tessellation of the Earth.
+static const GLdouble kSphereRadius = 0.25;
+static const GLint kSphereSlices = 48;
+static const GLint kSphereStacks = 24;
+
 @implementation Scene
 
 - init {
     self = [super init];
     if (self) {
         textureName = 0;
+        sphereLists[0] = 0;
+        sphereLists[1] = 0;
         animationPhase = 0.0;
         cameraDistance = 0.8;
         rollAngle = 0.0;
@@ -69,6 +76,12 @@ static double dtor( double degrees ) {
 }
 
 - (void)dealloc {
+    if (sphereLists[0]) {
+        glDeleteLists( sphereLists[0], 1 );
+    }
+    if (sphereLists[1]) {
+        glDeleteLists( sphereLists[1], 1 );
+    }
     [texture release];
     [super dealloc];
 }
@@ -138,13 +151,29 @@ static double dtor( double degrees ) {
     textureName = [texture textureName];
 }
 
-// This method renders our scene.  We could optimize it in any of several ways, including factoring out the repeated OpenGL initialization calls and either hanging onto the GLU quadric object or creating a Vertex Buffer Object that draws the Earth, but the details of how it's implemented aren't important here.  This code serves merely to give us some OpenGL content to look at.
+// Returns a display list drawing the Earth's sphere, filled or in wireframe.  Each style is tessellated once, on first use, and the list is then shared by every frame and by every context sharing objects with the one that built it (the view-based and layer-backed contexts do).
+- (GLuint)sphereListForWireframe:(BOOL)lines {
+    GLuint *list = &sphereLists[lines ? 1 : 0];
+    if (*list == 0) {
+        GLUquadric *quadric = gluNewQuadric();
+        if (lines) {
+            gluQuadricDrawStyle( quadric, GLU_LINE );
+        }
+        gluQuadricTexture( quadric, GL_TRUE );
+        *list = glGenLists( 1 );
+        glNewList( *list, GL_COMPILE );
+        gluSphere( quadric, kSphereRadius, kSphereSlices, kSphereStacks );
+        glEndList();
+        gluDeleteQuadric( quadric );
+    }
+    return *list;
+}
+
+// This method renders our scene.  We could optimize it further, for instance by factoring out the repeated OpenGL initialization calls or drawing the Earth from a Vertex Buffer Object, but the details of how it's implemented aren't important here.  This code serves merely to give us some OpenGL content to look at.
 - (void)render {
     static GLfloat lightDirection[] = { -0.7071, 0.0, 0.7071, 0.0 };
-    static GLfloat radius = 0.25;
     static GLfloat materialAmbient[4] = { 0.0, 0.0, 0.0, 0.0 };
     static GLfloat materialDiffuse[4] = { 1.0, 1.0, 1.0, 1.0 };
-    GLUquadric *quadric = NULL;
 
     // Set up rendering state.
     glEnable( GL_DEPTH_TEST );
@@ -168,20 +197,13 @@ static double dtor( double degrees ) {
         glTranslatef( 0.0, 0.0, -cameraDistance );
         
         // Draw the Earth!
-        quadric = gluNewQuadric();
-        if (wireframe) {
-            gluQuadricDrawStyle( quadric, GLU_LINE );
-        }
-        gluQuadricTexture( quadric, GL_TRUE );
         glMaterialfv( GL_FRONT, GL_AMBIENT, materialAmbient );
         glMaterialfv( GL_FRONT, GL_DIFFUSE, materialDiffuse );
         glRotatef( rollAngle, 1.0, 0.0, 0.0 );
         glRotatef( -23.45, 0.0, 0.0, 1.0 ); // Earth's axial tilt is 23.45 degrees from the plane of the ecliptic.
         glRotatef( animationPhase * 360.0, 0.0, 1.0, 0.0 );
         glRotatef( 90.0, 1.0, 0.0, 0.0 );
-        gluSphere( quadric, radius, 48, 24 );
-        gluDeleteQuadric(quadric);
-        quadric = NULL;
+        glCallList( [self sphereListForWireframe:wireframe] );
 
     glPopMatrix();
     
@@ -0,0 +1,729 @@
+/*
+     File: main.mm
+ Abstract:
+ Microbenchmarks for the matrix stacks used by the samples in this repository:
+
+   matrixUtil  - C utilities on column-major float[16] (GLEssentials)
+   vectorUtil  - C vector utilities, single and batched (GLEssentials)
+   trigUtil    - polynomial sincos / tan / atan2 against libm (GLEssentials)
+   GLM         - simd based transforms (GL3_Text GLMTransforms)
+   GLKit       - GLKMath, as used by BasicMultiGPUSample's BoingRenderer
+   Mat         - header-only constexpr templates (GL3_Text GLMMatrix.h)
+
+ Every backend runs the same operations over the same inputs.  Results are
+ written to stdout as JSON, one record per (backend, operation, size) with
+ the best-of-N time in nanoseconds per operation and the throughput in
+ GFLOP/s.  FLOP counts are the nominal arithmetic of the reference formulas
+ (see MB::Flops) so numbers are comparable between backends; sin, cos and tan
+ calls are not counted.
+
+ Usage: MathBench [--quick]
+
+ */
+
+#pragma mark -
+#pragma mark Private - Headers
+
+#import <chrono>
+#import <cmath>
+#import <cstdio>
+#import <cstdlib>
+#import <cstring>
+#import <vector>
+
+extern "C"
+{
+#import "matrixUtil.h"
+#import "trigUtil.h"
+#import "vectorUtil.h"
+}
+
+#import "GLMMatrix.h"
+#import "GLMTransforms.h"
+
+#if defined(__APPLE__)
+
+#import <GLKit/GLKMath.h>
+
+#endif
+
+#pragma mark -
+#pragma mark Private - Constants
+
+namespace MB
+{
+    // Number of distinct inputs cycled through by the single matrix operations
+    static const size_t kInputs = 64;
+
+    // Vector counts for the batch transform
+    static const size_t kBatchSizes[] = {16, 256, 4096, 65536};
+
+    // Nominal floating point operations per operation
+    enum Flops
+    {
+        eFlopsMultiply    = 112,    // 64 mul + 48 add
+        eFlopsInvert      = 196,    // cofactor expansion, determinant and scale
+        eFlopsPerspective = 6,
+        eFlopsLookAt      = 51,     // 2 normalize, 2 cross, 3 dot
+        eFlopsRotate      = 33,     // normalize axis and build the 3x3 block
+        eFlopsTransform   = 28,     // 16 mul + 12 add per vector
+        eFlopsNormalize   = 9,      // 3 mul, 2 add, 1 rsqrt or sqrt+div, 3 mul
+        eFlopsTrig        = 1       // Reported per evaluated function
+    }; // Flops
+} // MB
+
+#pragma mark -
+#pragma mark Private - Data Structures
+
+namespace MB
+{
+    struct Result
+    {
+        const char* mpBackend;
+        const char* mpOperation;
+        size_t      mnSize;
+        double      mnNsPerOp;
+        double      mnGFlops;
+    }; // Result
+
+    struct Options
+    {
+        size_t  mnRepeats;      // Best of N
+        double  mnMinTime;      // Minimum duration of a single timed run in seconds
+    }; // Options
+
+    // Inputs shared by all backends, stored as column-major float[16]
+    struct Inputs
+    {
+        float  mnA[kInputs][16];
+        float  mnB[kInputs][16];
+        float  mnScalar[kInputs][4];    // angle, x, y, z
+        float  mnEye[kInputs][3];
+
+        std::vector<float> m_Vectors;   // xyzw, largest batch size
+    }; // Inputs
+
+    static Options            g_Options = {7, 0.02};
+    static Inputs             g_Inputs;
+    static std::vector<Result> g_Results;
+
+    // Sink to keep results observable
+    static volatile float g_Sink = 0.0f;
+} // MB
+
+#pragma mark -
+#pragma mark Private - Utilities - Timing
+
+namespace MB
+{
+    // Calls rPass(), which performs nOps operations, until the run lasts at
+    // least the minimum time, and returns the best nanoseconds per operation
+    // over the repeats
+    template <typename Pass>
+    static double measure(const size_t& nOps, Pass&& rPass)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        // Warm up and calibrate the number of passes per run
+        size_t nPasses = 1;
+
+        for(;;)
+        {
+            Clock::time_point t0 = Clock::now();
+
+            for(size_t i = 0; i < nPasses; ++i)
+            {
+                rPass();
+            } // for
+
+            double nTime = std::chrono::duration<double>(Clock::now() - t0).count();
+
+            if(nTime >= g_Options.mnMinTime)
+            {
+                break;
+            } // if
+
+            nPasses *= 2;
+        } // for
+
+        double nBest = 1.0e30;
+
+        for(size_t r = 0; r < g_Options.mnRepeats; ++r)
+        {
+            Clock::time_point t0 = Clock::now();
+
+            for(size_t i = 0; i < nPasses; ++i)
+            {
+                rPass();
+            } // for
+
+            double nTime = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+            double nNsOp = nTime / double(nPasses * nOps);
+
+            if(nNsOp < nBest)
+            {
+                nBest = nNsOp;
+            } // if
+        } // for
+
+        return nBest;
+    } // measure
+
+    template <typename Pass>
+    static void run(const char* pBackend,
+                    const char* pOperation,
+                    const size_t& nSize,
+                    const size_t& nOps,
+                    const size_t& nFlopsPerOp,
+                    Pass&& rPass)
+    {
+        double nNsOp = measure(nOps, rPass);
+
+        Result result = {pBackend, pOperation, nSize, nNsOp, double(nFlopsPerOp) / nNsOp};
+
+        g_Results.push_back(result);
+    } // run
+} // MB
+
+#pragma mark -
+#pragma mark Private - Utilities - Inputs
+
+namespace MB
+{
+    static float random(const float& nMin, const float& nMax)
+    {
+        return nMin + (nMax - nMin) * float(std::rand()) / float(RAND_MAX);
+    } // random
+
+    static void inputsCreate(Inputs& rInputs)
+    {
+        std::srand(1);
+
+        for(size_t i = 0; i < kInputs; ++i)
+        {
+            // Well conditioned affine matrices so the inverses stay finite
+            mtxLoadIdentity(rInputs.mnA[i]);
+            mtxRotateApply(rInputs.mnA[i], random(0.0f, 360.0f), random(-1.0f, 1.0f), random(-1.0f, 1.0f), 1.0f);
+            mtxTranslateApply(rInputs.mnA[i], random(-10.0f, 10.0f), random(-10.0f, 10.0f), random(-10.0f, 10.0f));
+            mtxScaleApply(rInputs.mnA[i], random(0.5f, 2.0f), random(0.5f, 2.0f), random(0.5f, 2.0f));
+
+            mtxLoadPerspective(rInputs.mnB[i], random(30.0f, 90.0f), random(0.5f, 2.0f), 1.0f, 100.0f);
+
+            rInputs.mnScalar[i][0] = random(0.0f, 360.0f);
+            rInputs.mnScalar[i][1] = random(-1.0f, 1.0f);
+            rInputs.mnScalar[i][2] = random(-1.0f, 1.0f);
+            rInputs.mnScalar[i][3] = 1.0f;
+
+            rInputs.mnEye[i][0] = random(-10.0f, 10.0f);
+            rInputs.mnEye[i][1] = random(-10.0f, 10.0f);
+            rInputs.mnEye[i][2] = random(5.0f, 10.0f);
+        } // for
+
+        size_t nCount = kBatchSizes[sizeof(kBatchSizes) / sizeof(kBatchSizes[0]) - 1];
+
+        rInputs.m_Vectors.resize(4 * nCount);
+
+        for(size_t i = 0; i < nCount; ++i)
+        {
+            rInputs.m_Vectors[4 * i + 0] = random(-1.0f, 1.0f);
+            rInputs.m_Vectors[4 * i + 1] = random(-1.0f, 1.0f);
+            rInputs.m_Vectors[4 * i + 2] = random(-1.0f, 1.0f);
+            rInputs.m_Vectors[4 * i + 3] = 1.0f;
+        } // for
+    } // inputsCreate
+} // MB
+
+#pragma mark -
+#pragma mark Private - Backends - matrixUtil
+
+namespace MB
+{
+    static void benchMatrixUtil(const Inputs& rIn)
+    {
+        static float out[kInputs][16];
+
+        run("matrixUtil", "multiply", 1, kInputs, eFlopsMultiply, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                mtxMultiply(out[i], rIn.mnB[i], rIn.mnA[i]);
+            } // for
+            g_Sink = out[kInputs - 1][0];
+        });
+
+        run("matrixUtil", "invert", 1, kInputs, eFlopsInvert, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                mtxInvert(out[i], rIn.mnA[i]);
+            } // for
+            g_Sink = out[kInputs - 1][0];
+        });
+
+        run("matrixUtil", "perspective", 1, kInputs, eFlopsPerspective, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                mtxLoadPerspective(out[i], 30.0f + rIn.mnScalar[i][0] * 0.1f, 1.5f, 1.0f, 100.0f);
+            } // for
+            g_Sink = out[kInputs - 1][0];
+        });
+
+        run("matrixUtil", "rotate", 1, kInputs, eFlopsRotate, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                mtxLoadIdentity(out[i]);
+                mtxRotateApply(out[i], rIn.mnScalar[i][0], rIn.mnScalar[i][1], rIn.mnScalar[i][2], rIn.mnScalar[i][3]);
+            } // for
+            g_Sink = out[kInputs - 1][0];
+        });
+
+        run("matrixUtil", "rotateN", 1, kInputs, eFlopsRotate, [&]() {
+            static float deg[kInputs], x[kInputs], y[kInputs], z[kInputs];
+
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                deg[i] = rIn.mnScalar[i][0];
+                x[i]   = rIn.mnScalar[i][1];
+                y[i]   = rIn.mnScalar[i][2];
+                z[i]   = rIn.mnScalar[i][3];
+            } // for
+
+            mtxLoadRotateN(out[0], deg, x, y, z, (unsigned int)kInputs);
+            g_Sink = out[kInputs - 1][0];
+        });
+
+        // No look-at or vector transform in matrixUtil.  The transform row
+        // is a plain scalar loop over the same column-major float[16], as a
+        // baseline for the other backends rather than a matrixUtil result.
+
+        for(size_t nSize : kBatchSizes)
+        {
+            std::vector<float> dst(4 * nSize);
+
+            run("reference", "transform", nSize, nSize, eFlopsTransform, [&]() {
+                const float* m = rIn.mnA[0];
+                const float* v = rIn.m_Vectors.data();
+                float*       d = dst.data();
+
+                for(size_t i = 0; i < nSize; ++i, v += 4, d += 4)
+                {
+                    d[0] = m[0] * v[0] + m[4] * v[1] + m[ 8] * v[2] + m[12] * v[3];
+                    d[1] = m[1] * v[0] + m[5] * v[1] + m[ 9] * v[2] + m[13] * v[3];
+                    d[2] = m[2] * v[0] + m[6] * v[1] + m[10] * v[2] + m[14] * v[3];
+                    d[3] = m[3] * v[0] + m[7] * v[1] + m[11] * v[2] + m[15] * v[3];
+                } // for
+                g_Sink = dst[0];
+            });
+        } // for
+    } // benchMatrixUtil
+} // MB
+
+#pragma mark -
+#pragma mark Private - Backends - vectorUtil
+
+namespace MB
+{
+    static void benchVectorUtil(const Inputs& rIn)
+    {
+        static const struct
+        {
+            const char*   mpName;
+            vecPrecision  mnPrecision;
+        } kModes[] =
+        {
+            {"normalizeN-fast",    VEC_PRECISION_FAST},
+            {"normalizeN-refined", VEC_PRECISION_REFINED},
+            {"normalizeN-exact",   VEC_PRECISION_EXACT}
+        };
+
+        for(size_t nSize : kBatchSizes)
+        {
+            // Reuse the xyzw vectors as three SoA streams of nSize elements
+            const float* pSrc = rIn.m_Vectors.data();
+
+            std::vector<float> dst(4 * nSize);
+
+            run("vectorUtil", "normalize", nSize, nSize, eFlopsNormalize, [&]() {
+                for(size_t i = 0; i < nSize; ++i)
+                {
+                    vec3Normalize(&dst[4 * i], &pSrc[4 * i]);
+                } // for
+                g_Sink = dst[0];
+            });
+
+            for(const auto& mode : kModes)
+            {
+                run("vectorUtil", mode.mpName, nSize, nSize, eFlopsNormalize, [&]() {
+                    vec3NormalizeN(&dst[0], &dst[nSize], &dst[2 * nSize],
+                                   &pSrc[0], &pSrc[nSize], &pSrc[2 * nSize],
+                                   (unsigned int)nSize, mode.mnPrecision);
+                    g_Sink = dst[0];
+                });
+            } // for
+        } // for
+    } // benchVectorUtil
+} // MB
+
+#pragma mark -
+#pragma mark Private - Backends - trigUtil
+
+namespace MB
+{
+    static void benchTrigUtil(const Inputs& rIn)
+    {
+        for(size_t nSize : kBatchSizes)
+        {
+            // Angles in [-pi, pi] and atan2 arguments from the xyzw vectors
+            std::vector<float> angle(nSize), a(nSize), b(nSize);
+
+            for(size_t i = 0; i < nSize; ++i)
+            {
+                angle[i] = float(M_PI) * rIn.m_Vectors[4 * i];
+            } // for
+
+            const float* pY = &rIn.m_Vectors[0];
+            const float* pX = &rIn.m_Vectors[nSize];
+
+            run("libm", "sincos", nSize, nSize, eFlopsTrig, [&]() {
+                for(size_t i = 0; i < nSize; ++i)
+                {
+                    a[i] = std::sin(angle[i]);
+                    b[i] = std::cos(angle[i]);
+                } // for
+                g_Sink = a[0] + b[0];
+            });
+
+            run("trigUtil", "sincos", nSize, nSize, eFlopsTrig, [&]() {
+                trigSinCosN(a.data(), b.data(), angle.data(), (unsigned int)nSize);
+                g_Sink = a[0] + b[0];
+            });
+
+            run("libm", "tan", nSize, nSize, eFlopsTrig, [&]() {
+                for(size_t i = 0; i < nSize; ++i)
+                {
+                    a[i] = std::tan(angle[i]);
+                } // for
+                g_Sink = a[0];
+            });
+
+            run("trigUtil", "tan", nSize, nSize, eFlopsTrig, [&]() {
+                trigTanN(a.data(), angle.data(), (unsigned int)nSize);
+                g_Sink = a[0];
+            });
+
+            run("libm", "atan2", nSize, nSize, eFlopsTrig, [&]() {
+                for(size_t i = 0; i < nSize; ++i)
+                {
+                    a[i] = std::atan2(pY[i], pX[i]);
+                } // for
+                g_Sink = a[0];
+            });
+
+            run("trigUtil", "atan2", nSize, nSize, eFlopsTrig, [&]() {
+                trigAtan2N(a.data(), pY, pX, (unsigned int)nSize);
+                g_Sink = a[0];
+            });
+        } // for
+    } // benchTrigUtil
+} // MB
+
+#pragma mark -
+#pragma mark Private - Backends - Mat
+
+namespace MB
+{
+    static void benchMat(const Inputs& rIn)
+    {
+        static GLM::Mat4 in[2][kInputs];
+        static GLM::Mat4 out[kInputs];
+
+        for(size_t i = 0; i < kInputs; ++i)
+        {
+            in[0][i] = GLM::Mat4::load(rIn.mnA[i]);
+            in[1][i] = GLM::Mat4::load(rIn.mnB[i]);
+        } // for
+
+        run("Mat", "multiply", 1, kInputs, eFlopsMultiply, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = in[1][i] * in[0][i];
+            } // for
+            g_Sink = out[kInputs - 1].m[0];
+        });
+
+        run("Mat", "lookAt", 1, kInputs, eFlopsLookAt, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                GLM::Vec3 eye = {{rIn.mnEye[i][0], rIn.mnEye[i][1], rIn.mnEye[i][2]}};
+
+                out[i] = GLM::lookAt(eye, GLM::Vec3{{0.0f, 0.0f, 0.0f}}, GLM::Vec3{{0.0f, 1.0f, 0.0f}});
+            } // for
+            g_Sink = out[kInputs - 1].m[0];
+        });
+
+        for(size_t nSize : kBatchSizes)
+        {
+            std::vector<GLM::Vec4> dst(nSize);
+
+            const GLM::Vec4* pSrc = reinterpret_cast<const GLM::Vec4*>(rIn.m_Vectors.data());
+
+            run("Mat", "transform", nSize, nSize, eFlopsTransform, [&]() {
+                const GLM::Mat4& M = in[0][0];
+
+                for(size_t i = 0; i < nSize; ++i)
+                {
+                    dst[i] = M * pSrc[i];
+                } // for
+                g_Sink = dst[0][0];
+            });
+
+            // Fused P * V * M * v against the same three matrices
+            run("Mat", "transform3", nSize, nSize, 3 * eFlopsTransform, [&]() {
+                const GLM::Mat4& P = in[1][0];
+                const GLM::Mat4& V = in[0][1];
+                const GLM::Mat4& M = in[0][0];
+
+                for(size_t i = 0; i < nSize; ++i)
+                {
+                    dst[i] = P * V * M * pSrc[i];
+                } // for
+                g_Sink = dst[0][0];
+            });
+        } // for
+    } // benchMat
+} // MB
+
+#pragma mark -
+#pragma mark Private - Backends - GLM
+
+namespace MB
+{
+    static void benchGLM(const Inputs& rIn)
+    {
+        static simd::float4x4 in[2][kInputs];
+        static simd::float4x4 out[kInputs];
+
+        for(size_t i = 0; i < kInputs; ++i)
+        {
+            std::memcpy(&in[0][i], rIn.mnA[i], sizeof(simd::float4x4));
+            std::memcpy(&in[1][i], rIn.mnB[i], sizeof(simd::float4x4));
+        } // for
+
+        run("GLM", "multiply", 1, kInputs, eFlopsMultiply, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = in[1][i] * in[0][i];
+            } // for
+            g_Sink = out[kInputs - 1].columns[0].x;
+        });
+
+        run("GLM", "invert", 1, kInputs, eFlopsInvert, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = simd::inverse(in[0][i]);
+            } // for
+            g_Sink = out[kInputs - 1].columns[0].x;
+        });
+
+        run("GLM", "perspective", 1, kInputs, eFlopsPerspective, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = GLM::perspective(30.0f + rIn.mnScalar[i][0] * 0.1f, 1.5f, 1.0f, 100.0f);
+            } // for
+            g_Sink = out[kInputs - 1].columns[0].x;
+        });
+
+        run("GLM", "lookAt", 1, kInputs, eFlopsLookAt, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                simd::float3 eye    = {rIn.mnEye[i][0], rIn.mnEye[i][1], rIn.mnEye[i][2]};
+                simd::float3 center = {0.0f, 0.0f, 0.0f};
+                simd::float3 up     = {0.0f, 1.0f, 0.0f};
+
+                out[i] = GLM::lookAt(eye, center, up);
+            } // for
+            g_Sink = out[kInputs - 1].columns[0].x;
+        });
+
+        run("GLM", "rotate", 1, kInputs, eFlopsRotate, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = GLM::rotate(rIn.mnScalar[i][0], rIn.mnScalar[i][1], rIn.mnScalar[i][2], rIn.mnScalar[i][3]);
+            } // for
+            g_Sink = out[kInputs - 1].columns[0].x;
+        });
+
+        for(size_t nSize : kBatchSizes)
+        {
+            std::vector<simd::float4> dst(nSize);
+
+            const simd::float4* pSrc = reinterpret_cast<const simd::float4*>(rIn.m_Vectors.data());
+
+            run("GLM", "transform", nSize, nSize, eFlopsTransform, [&]() {
+                const simd::float4x4& M = in[0][0];
+
+                for(size_t i = 0; i < nSize; ++i)
+                {
+                    dst[i] = M * pSrc[i];
+                } // for
+                g_Sink = dst[0].x;
+            });
+        } // for
+    } // benchGLM
+} // MB
+
+#if defined(__APPLE__)
+
+#pragma mark -
+#pragma mark Private - Backends - GLKit
+
+namespace MB
+{
+    static void benchGLKit(const Inputs& rIn)
+    {
+        static GLKMatrix4 in[2][kInputs];
+        static GLKMatrix4 out[kInputs];
+
+        for(size_t i = 0; i < kInputs; ++i)
+        {
+            in[0][i] = GLKMatrix4MakeWithArray(const_cast<float*>(rIn.mnA[i]));
+            in[1][i] = GLKMatrix4MakeWithArray(const_cast<float*>(rIn.mnB[i]));
+        } // for
+
+        run("GLKit", "multiply", 1, kInputs, eFlopsMultiply, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = GLKMatrix4Multiply(in[1][i], in[0][i]);
+            } // for
+            g_Sink = out[kInputs - 1].m[0];
+        });
+
+        run("GLKit", "invert", 1, kInputs, eFlopsInvert, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = GLKMatrix4Invert(in[0][i], NULL);
+            } // for
+            g_Sink = out[kInputs - 1].m[0];
+        });
+
+        run("GLKit", "perspective", 1, kInputs, eFlopsPerspective, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = GLKMatrix4MakePerspective(GLKMathDegreesToRadians(30.0f + rIn.mnScalar[i][0] * 0.1f), 1.5f, 1.0f, 100.0f);
+            } // for
+            g_Sink = out[kInputs - 1].m[0];
+        });
+
+        run("GLKit", "lookAt", 1, kInputs, eFlopsLookAt, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = GLKMatrix4MakeLookAt(rIn.mnEye[i][0], rIn.mnEye[i][1], rIn.mnEye[i][2],
+                                              0.0f, 0.0f, 0.0f,
+                                              0.0f, 1.0f, 0.0f);
+            } // for
+            g_Sink = out[kInputs - 1].m[0];
+        });
+
+        run("GLKit", "rotate", 1, kInputs, eFlopsRotate, [&]() {
+            for(size_t i = 0; i < kInputs; ++i)
+            {
+                out[i] = GLKMatrix4MakeRotation(GLKMathDegreesToRadians(rIn.mnScalar[i][0]),
+                                                rIn.mnScalar[i][1], rIn.mnScalar[i][2], rIn.mnScalar[i][3]);
+            } // for
+            g_Sink = out[kInputs - 1].m[0];
+        });
+
+        for(size_t nSize : kBatchSizes)
+        {
+            std::vector<GLKVector4> dst(nSize);
+
+            run("GLKit", "transform", nSize, nSize, eFlopsTransform, [&]() {
+                std::memcpy(dst.data(), rIn.m_Vectors.data(), nSize * sizeof(GLKVector4));
+
+                GLKMatrix4MultiplyVector4Array(in[0][0], dst.data(), size_t(nSize));
+
+                g_Sink = dst[0].x;
+            });
+        } // for
+    } // benchGLKit
+} // MB
+
+#endif
+
+#pragma mark -
+#pragma mark Private - Utilities - Output
+
+namespace MB
+{
+    static const char* platform()
+    {
+#if defined(__x86_64__)
+        return "x86_64";
+#elif defined(__aarch64__) || defined(__arm64__)
+        return "arm64";
+#elif defined(__arm__)
+        return "arm";
+#else
+        return "unknown";
+#endif
+    } // platform
+
+    static void resultsWrite(FILE* pFile)
+    {
+        std::fprintf(pFile,
+                     "{\n  \"platform\": \"%s\",\n  \"simd\": \"%s\",\n  \"results\": [\n",
+                     platform(),
+                     GLM_SIMD_BACKEND);
+
+        for(size_t i = 0; i < g_Results.size(); ++i)
+        {
+            const Result& r = g_Results[i];
+
+            std::fprintf(pFile,
+                         "    {\"backend\": \"%s\", \"op\": \"%s\", \"size\": %zu, \"ns_per_op\": %.4f, \"gflops\": %.4f}%s\n",
+                         r.mpBackend,
+                         r.mpOperation,
+                         r.mnSize,
+                         r.mnNsPerOp,
+                         r.mnGFlops,
+                         (i + 1 < g_Results.size()) ? "," : "");
+        } // for
+
+        std::fprintf(pFile, "  ]\n}\n");
+    } // resultsWrite
+} // MB
+
+#pragma mark -
+#pragma mark Public - Entry Point
+
+int main(int argc, const char * argv[])
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--quick") == 0)
+        {
+            MB::g_Options.mnRepeats = 3;
+            MB::g_Options.mnMinTime = 0.002;
+        } // if
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--quick]\n", argv[0]);
+
+            return EXIT_FAILURE;
+        } // else
+    } // for
+
+    MB::inputsCreate(MB::g_Inputs);
+
+    MB::benchMatrixUtil(MB::g_Inputs);
+    MB::benchVectorUtil(MB::g_Inputs);
+    MB::benchTrigUtil(MB::g_Inputs);
+    MB::benchMat(MB::g_Inputs);
+    MB::benchGLM(MB::g_Inputs);
+
+#if defined(__APPLE__)
+    MB::benchGLKit(MB::g_Inputs);
+#endif
+
+    MB::resultsWrite(stdout);
+
+    return EXIT_SUCCESS;
+} // main